@@ -0,0 +1,264 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * async_emission.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <iterator>
+#include <exception>
+#include <type_traits>
+
+#include "signal.h"
+#include "executor.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	namespace detail
+	{
+		/*
+		 CASYNCRESULTS
+
+		 Values returned by the slots of an asynchronous emission, in the order of the connections like the
+		 arrays filled by CSignal. Every slot writes its own element, so no synchronization is needed.
+		 */
+		template<typename TValue>
+		class CAsyncResults
+		{
+		public:
+			using TResult = std::vector<TValue>;
+
+		public:
+			explicit CAsyncResults(const unsigned count) :
+				mp_values(new TValue[count]),
+				m_count(count)
+			{}
+
+		public:
+			template<typename TCall>
+			void Store(const unsigned index, TCall& call) { mp_values[index] = call(); }
+
+			void Fulfill(std::promise<TResult>& promise)
+			{
+				TValue* values = mp_values.get();
+				promise.set_value(TResult(std::make_move_iterator(values), std::make_move_iterator(values + m_count)));
+			}
+
+		private:
+			// Not a vector, std::vector<bool> doesn't allow writing different elements from different threads
+			std::unique_ptr<TValue[]>	mp_values;
+			unsigned					m_count;
+		};
+
+		template<>
+		class CAsyncResults<void>
+		{
+		public:
+			using TResult = void;
+
+		public:
+			explicit CAsyncResults(const unsigned count) {}
+
+		public:
+			template<typename TCall>
+			void Store(const unsigned index, TCall& call) { call(); }
+
+			void Fulfill(std::promise<TResult>& promise) { promise.set_value(); }
+		};
+
+		/*
+		 CASYNCEMISSION
+
+		 State shared by the tasks of one asynchronous emission: the connections to invoke, a single copy of
+		 the arguments for all of them and the results. The last task completing fulfills the promise.
+		 */
+		template<typename TConnection, typename TValue, typename... Args>
+		class CAsyncEmission
+		{
+		public:
+			using TResult		= typename CAsyncResults<TValue>::TResult;
+			using TArguments	= std::tuple<typename std::decay<Args>::type...>;
+
+		public:
+			template<typename... TArgs>
+			CAsyncEmission(std::vector<TConnection>&& connections, TArgs&&... args);
+
+		public:
+			const unsigned Count() const { return m_connections.size(); }
+
+			const TConnection& Connection(const unsigned index) const { return m_connections[index]; }
+
+			TArguments& Arguments() { return m_arguments; }
+
+			std::future<TResult> Future() { return m_promise.get_future(); }
+
+		public:
+			// Runs the call of the slot at index, the first exception thrown by a slot is kept for the future
+			template<typename TCall>
+			void Complete(const unsigned index, TCall&& call);
+
+			void Fulfill();
+
+		private:
+			// Moved in, so the connections are not relocated and stay bound to themselves
+			std::vector<TConnection>	m_connections;
+			TArguments					m_arguments;
+			CAsyncResults<TValue>		m_results;
+
+			std::atomic<unsigned>		m_pending;
+			std::atomic<bool>			m_hasFailed;
+			std::exception_ptr			m_exception;
+			std::promise<TResult>		m_promise;
+		};
+
+		template<typename TConnection, typename TValue, typename... Args>
+		template<typename... TArgs>
+		CAsyncEmission<TConnection, TValue, Args...>::CAsyncEmission(std::vector<TConnection>&& connections, TArgs&&... args) :
+			m_connections(std::move(connections)),
+			m_arguments(std::forward<TArgs>(args)...),
+			m_results(m_connections.size()),
+			m_pending(m_connections.size()),
+			m_hasFailed(false)
+		{}
+
+		template<typename TConnection, typename TValue, typename... Args>
+		template<typename TCall>
+		void CAsyncEmission<TConnection, TValue, Args...>::Complete(const unsigned index, TCall&& call)
+		{
+			try
+			{
+				m_results.Store(index, call);
+			}
+			catch (...)
+			{
+				if (!m_hasFailed.exchange(true))
+				{
+					m_exception = std::current_exception();
+				}
+			}
+
+			// The release of every task pairs with the acquire of the last one
+			if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Fulfill();
+			}
+		}
+
+		template<typename TConnection, typename TValue, typename... Args>
+		void CAsyncEmission<TConnection, TValue, Args...>::Fulfill()
+		{
+			if (m_exception)
+			{
+				m_promise.set_exception(m_exception);
+			}
+			else
+			{
+				m_results.Fulfill(m_promise);
+			}
+		}
+
+		/*
+		 CASYNCEMITTER
+
+		 Schedules the slots of a signal in an executor. It's a friend of the signals, which don't depend on
+		 the executors unless this header is included.
+		 */
+		template<typename ReturnType, typename... Args>
+		class CAsyncEmitter<CSignal<ReturnType(Args...)>>
+		{
+		public:
+			using TSignal		= CSignal<ReturnType(Args...)>;
+			using TConnection	= typename TSignal::TConnection;
+			using TResult		= typename CAsyncResults<typename std::decay<ReturnType>::type>::TResult;
+
+		public:
+			static std::future<TResult> Emit(CExecutor& executor, TSignal& signal, Args... args);
+		};
+
+		template<typename ReturnType, typename... Args>
+		std::future<typename CAsyncEmitter<CSignal<ReturnType(Args...)>>::TResult> CAsyncEmitter<CSignal<ReturnType(Args...)>>::Emit(CExecutor& executor, TSignal& signal, Args... args)
+		{
+			using TEmission = CAsyncEmission<TConnection, typename std::decay<ReturnType>::type, Args...>;
+			using TIndices = typename TMakeIndexSequence<sizeof...(Args)>::TType;
+
+			DCPP_SIGNALS_PROBE_EMIT(signal.mp_binding);
+
+			// Copies of the connections, so connecting or disconnecting doesn't affect the emission in flight.
+			// The storage is reserved first so the copies are not relocated.
+			std::vector<TConnection> connections;
+			connections.reserve(signal.Count());
+			for (const TConnection& connection : signal.m_connections)
+			{
+				if (signal.Acquire(connection))
+				{
+					connections.push_back(connection);
+				}
+			}
+			signal.RemoveConsumed();
+
+			std::shared_ptr<TEmission> emission = std::make_shared<TEmission>(std::move(connections), args...);
+			std::future<TResult> future = emission->Future();
+			if (emission->Count() == 0)
+			{
+				emission->Fulfill();
+				return future;
+			}
+
+			for (unsigned i = 0; i < emission->Count(); ++i)
+			{
+				executor.Post([emission, i]()
+				{
+					emission->Complete(i, [&emission, i]()
+					{
+						return TSignal::Invoke(emission->Connection(i), emission->Arguments(), TIndices());
+					});
+				});
+			}
+			return future;
+		}
+	}
+
+	// Future of an asynchronous emission of the signal: a vector with the value of every slot, or void
+	template<typename TSignal>
+	using TAsyncResult = typename detail::CAsyncEmitter<TSignal>::TResult;
+
+	/*
+	 Schedules every slot of the signal in the default thread pool and returns without waiting for them. The
+	 results come in the order of the connections, like in the array overload. The arguments are copied once
+	 and shared by all the slots, which may run concurrently.
+	 The slots, and the objects the arguments point to, must outlive the emission.
+
+		std::future<std::vector<int>> sizes = dc::EmitAsync(signal, path);
+	 */
+	template<typename ReturnType, typename... Args, typename... TArgs>
+	std::future<TAsyncResult<CSignal<ReturnType(Args...)>>> EmitAsync(CSignal<ReturnType(Args...)>& signal, TArgs&&... args)
+	{
+		return detail::CAsyncEmitter<CSignal<ReturnType(Args...)>>::Emit(CThreadPool::Default(), signal, std::forward<TArgs>(args)...);
+	}
+
+	template<typename ReturnType, typename... Args, typename... TArgs>
+	std::future<TAsyncResult<CSignal<ReturnType(Args...)>>> EmitAsyncOn(CExecutor& executor, CSignal<ReturnType(Args...)>& signal, TArgs&&... args)
+	{
+		return detail::CAsyncEmitter<CSignal<ReturnType(Args...)>>::Emit(executor, signal, std::forward<TArgs>(args)...);
+	}
+}
@@ -0,0 +1,228 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * bubbling_signal.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <vector>
+#include <utility>
+
+#include "signal.h"
+
+namespace dc
+{
+	template<typename TSignature>
+	class CBubblingSignal;
+
+	/*
+	 CBUBBLINGSIGNAL
+
+	 Signal of a node in a tree, like a widget or a scene node, whose emissions bubble up through its ancestors.
+	 The slots return true to stop the propagation: the rest of the slots of their node are still invoked but
+	 the ancestors aren't. The path from the node to the root is cached, so an emission is a flat loop over it
+	 with no recursion nor allocation. It's rebuilt on the next emission after the node or one of its
+	 ancestors changes its parent.
+	 The tree can't change while it's emitting.
+	 */
+	template<typename... Args>
+	class CBubblingSignal<bool(Args...)>
+	{
+	public:
+		using TSignal = CSignal<bool(Args...)>;
+		using TConnection = typename TSignal::TConnection;
+
+	private:
+		// Array for the emissions of every node that only remembers if some slot stopped the propagation
+		struct SPropagation
+		{
+			SPropagation() : m_isStopped(false) {}
+
+			SPropagation& operator[] (const int index) { return *this; }
+
+			SPropagation& operator= (const bool isStopped) { m_isStopped |= isStopped; return *this; }
+
+			bool m_isStopped;
+		};
+
+	public:
+		explicit CBubblingSignal(CBubblingSignal* parent = 0);
+
+		~CBubblingSignal();
+
+	private:
+		CBubblingSignal(const CBubblingSignal& copy) = delete;
+		CBubblingSignal& operator= (const CBubblingSignal& copy) = delete;
+
+	public:
+		template<typename... TSlot>
+		TConnection& Connect(TSlot&&... slot) { return m_signal.Connect(std::forward<TSlot>(slot)...); }
+
+		template<typename T>
+		TConnection& ConnectOwned(T&& callable) { return m_signal.ConnectOwned(std::forward<T>(callable)); }
+
+		template<typename... TSlot>
+		void Disconnect(TSlot&&... slot) { m_signal.Disconnect(std::forward<TSlot>(slot)...); }
+
+		const unsigned Count() const { return m_signal.Count(); }
+
+		TSignal& Signal() { return m_signal; }
+
+		CBubblingSignal* Parent() const { return mp_parent; }
+
+		// Moves the node and its descendants under another parent, or makes it a root with null
+		void SetParent(CBubblingSignal* parent);
+
+		// Emits from this node to the root. Returns true if a slot stopped the propagation.
+		const bool operator() (Args... args);
+
+	private:
+		const std::vector<CBubblingSignal*>& Path();
+
+		void Link(CBubblingSignal* parent);
+
+		void Unlink();
+
+		// Marks the paths of the node and its descendants to be rebuilt
+		void InvalidatePaths();
+
+	private:
+		TSignal							m_signal;
+		CBubblingSignal*				mp_parent;
+		CBubblingSignal*				mp_firstChild;
+		CBubblingSignal*				mp_nextSibling;
+		std::vector<CBubblingSignal*>	m_path;
+		bool							m_isPathValid;
+	};
+
+	template<typename... Args>
+	CBubblingSignal<bool(Args...)>::CBubblingSignal(CBubblingSignal* parent) :
+		mp_parent(0),
+		mp_firstChild(0),
+		mp_nextSibling(0),
+		m_isPathValid(false)
+	{
+		Link(parent);
+	}
+
+	template<typename... Args>
+	CBubblingSignal<bool(Args...)>::~CBubblingSignal()
+	{
+		// The children become roots
+		while (mp_firstChild)
+		{
+			mp_firstChild->SetParent(0);
+		}
+		Unlink();
+	}
+
+	template<typename... Args>
+	void CBubblingSignal<bool(Args...)>::SetParent(CBubblingSignal* parent)
+	{
+		if (parent == mp_parent) return;
+
+		for (const CBubblingSignal* ancestor = parent; ancestor; ancestor = ancestor->mp_parent)
+		{
+			assert(ancestor != this && "A node can't be a descendant of itself");
+		}
+
+		Unlink();
+		Link(parent);
+		InvalidatePaths();
+	}
+
+	template<typename... Args>
+	const bool CBubblingSignal<bool(Args...)>::operator() (Args... args)
+	{
+		for (CBubblingSignal* node : Path())
+		{
+			SPropagation propagation;
+			node->m_signal(propagation, args...);
+			if (propagation.m_isStopped) return true;
+		}
+		return false;
+	}
+
+	template<typename... Args>
+	const std::vector<CBubblingSignal<bool(Args...)>*>& CBubblingSignal<bool(Args...)>::Path()
+	{
+		if (!m_isPathValid)
+		{
+			// Keeping the capacity, the path of a node rarely grows
+			m_path.clear();
+			for (CBubblingSignal* node = this; node; node = node->mp_parent)
+			{
+				m_path.push_back(node);
+			}
+			m_isPathValid = true;
+		}
+		return m_path;
+	}
+
+	template<typename... Args>
+	void CBubblingSignal<bool(Args...)>::Link(CBubblingSignal* parent)
+	{
+		mp_parent = parent;
+		if (parent)
+		{
+			mp_nextSibling = parent->mp_firstChild;
+			parent->mp_firstChild = this;
+		}
+	}
+
+	template<typename... Args>
+	void CBubblingSignal<bool(Args...)>::Unlink()
+	{
+		if (!mp_parent) return;
+
+		CBubblingSignal** link = &mp_parent->mp_firstChild;
+		while (*link != this)
+		{
+			link = &(*link)->mp_nextSibling;
+		}
+		*link = mp_nextSibling;
+
+		mp_parent = 0;
+		mp_nextSibling = 0;
+	}
+
+	template<typename... Args>
+	void CBubblingSignal<bool(Args...)>::InvalidatePaths()
+	{
+		// Walking the subtree in preorder through the links, without a stack
+		CBubblingSignal* node = this;
+		while (true)
+		{
+			node->m_isPathValid = false;
+			if (node->mp_firstChild)
+			{
+				node = node->mp_firstChild;
+				continue;
+			}
+
+			while (node != this && !node->mp_nextSibling)
+			{
+				node = node->mp_parent;
+			}
+
+			if (node == this) return;
+
+			node = node->mp_nextSibling;
+		}
+	}
+}
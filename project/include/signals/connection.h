@@ -23,13 +23,230 @@
 
 #pragma once
 
+#include <vector>
 #include <utility>
+#include <cstring>
+#include <cassert>
+#include <type_traits>
+
+#include "instrumentation.h"
+#include "profiler.h"
+#include "tracer.h"
+#include "memory_usage.h"
+#include "slab_allocator.h"
 
 namespace dc
 {
 	// Forward declaration for the signals
 	template<typename ReturnType, typename... Args>
 	class CSignal;
+
+	template<typename TEnum, typename Signature, unsigned KeyCount>
+	class CSignalTable;
+
+	template<typename TSignature, unsigned HistorySize>
+	class CReplaySignal;
+
+	/*
+	 SSIGNALWAITER
+
+	 Node of the intrusive list of the waiters of a signal, like the coroutines awaiting its next emission.
+	 The nodes live inside the waiters, so waiting doesn't allocate.
+	 */
+	struct SSignalWaiter
+	{
+		SSignalWaiter*	mp_next;
+
+		// Head of the list where the waiter is linked, null when it isn't waiting
+		SSignalWaiter**	mp_list;
+
+		// Called by the next emission with a tuple of references to its arguments
+		void			(*mp_notify)(SSignalWaiter* waiter, void* arguments);
+	};
+
+	template<typename TSignal>
+	class CSignalBinding;
+
+	/*
+	 SSIGNALRELAYS
+
+	 Links of a signal connected to other signals, see CSignal::ConnectSignal. The leaf slots of the whole
+	 relay chain are kept flattened so the emission is a single loop over them. Any change in a signal of
+	 the chain invalidates the flattened slots of the signals forwarding to it, and they are rebuilt by the
+	 next outermost emission.
+	 */
+	template<typename TSignal>
+	struct SSignalRelays
+	{
+		using TBinding		= CSignalBinding<TSignal>;
+
+		// Leaf slot as the binding of its signal and its index there, the slots connecting during an
+		// emission reallocate the connections so no pointer to them is kept
+		struct SFlattenedSlot
+		{
+			TBinding*	mp_binding;
+			unsigned	m_index;
+		};
+
+		SSignalRelays() : m_relayCount(0), m_isFlattened(false) {}
+
+		// Signals forwarding to this one, once per relay connection
+		std::vector<TBinding*>			m_upstreams;
+
+		std::vector<SFlattenedSlot>		m_flattened;
+
+		// Relay connections of this signal
+		unsigned						m_relayCount;
+		bool							m_isFlattened;
+	};
+
+	/*
+	 CSIGNALBINDING
+
+	 Indirection between a signal and its connections. It lives in the heap and is owned by the signal,
+	 so moving a signal only updates the pointer kept here instead of every connection bound to it.
+	 */
+	template<typename TSignal>
+	class CSignalBinding
+	{
+	public:
+		explicit CSignalBinding(TSignal* signal) :
+			mp_signal(signal),
+			mp_name(0),
+			mp_profiler(0),
+			mp_waiters(0),
+			mp_relays(0),
+			m_accountedBytes(0),
+			m_emissionDepth(0)
+#if defined(DCPP_SIGNALS_INSTRUMENTATION)
+			, m_stats(this)
+#endif
+		{}
+
+		~CSignalBinding()
+		{
+			delete mp_profiler;
+			delete mp_relays;
+		}
+
+		// The bindings of all the signals are packed together in the slab allocator
+		static void* operator new(std::size_t size) { return CSlabAllocator::Allocate(size); }
+
+		static void operator delete(void* memory, std::size_t size) { CSlabAllocator::Deallocate(memory, size); }
+
+	private:
+		CSignalBinding(const CSignalBinding& copy) = delete;
+		CSignalBinding& operator= (const CSignalBinding& copy) = delete;
+
+	public:
+		TSignal*		mp_signal;
+		const char*		mp_name;
+
+		// Only present while the profiling of the signal is enabled
+		CSlotProfiler*	mp_profiler;
+
+		// Waiters of the next emission, in reverse order of arrival
+		SSignalWaiter*	mp_waiters;
+
+		// Only present for the signals connected to other signals
+		SSignalRelays<TSignal>*	mp_relays;
+
+		// Heap bytes of the signal already added to CSignalMemory
+		std::size_t		m_accountedBytes;
+
+		// Emissions running, the consumed connections are only removed when the outermost one returns
+		unsigned		m_emissionDepth;
+
+#if defined(DCPP_SIGNALS_INSTRUMENTATION)
+		CSignalStats	m_stats;
+#endif
+	};
+
+	/*
+	 SOWNEDCALLABLE
+
+	 Header of a callable stored by a connection instead of referenced. The functions keep the type of the
+	 callable, which is built next to the header in the same block of the slab allocator.
+	 */
+	struct SOwnedCallable
+	{
+		void*			mp_callable;
+
+		// Size of the whole block
+		std::size_t		m_size;
+
+		void			(*mp_destroy)(SOwnedCallable* owned);
+
+		// Null when the callable can't be copied
+		SOwnedCallable*	(*mp_clone)(const SOwnedCallable* owned);
+	};
+
+	/*
+	 COWNEDCALLABLE
+
+	 Owned callable of type T. The blocks are added to CSignalMemory while they live.
+	 */
+	template<typename T>
+	class COwnedCallable : public SOwnedCallable
+	{
+	public:
+		template<typename TArg>
+		static COwnedCallable* Create(TArg&& callable);
+
+		T& Callable() { return m_callable; }
+
+	private:
+		template<typename TArg>
+		explicit COwnedCallable(TArg&& callable);
+
+		static void Destroy(SOwnedCallable* owned);
+
+		static SOwnedCallable* Clone(const SOwnedCallable* owned);
+
+		static SOwnedCallable* (*CloneFunction(std::true_type isCopyable))(const SOwnedCallable*) { return &Clone; }
+
+		static SOwnedCallable* (*CloneFunction(std::false_type isCopyable))(const SOwnedCallable*) { return 0; }
+
+	private:
+		T m_callable;
+	};
+
+	template<typename T>
+	template<typename TArg>
+	COwnedCallable<T>* COwnedCallable<T>::Create(TArg&& callable)
+	{
+		static_assert(alignof(COwnedCallable) <= CSlabAllocator::kGranularity, "The callable is over aligned for the slab allocator");
+
+		void* memory = CSlabAllocator::Allocate(sizeof(COwnedCallable));
+		CSignalMemory::Add(sizeof(COwnedCallable));
+		return new (memory) COwnedCallable(std::forward<TArg>(callable));
+	}
+
+	template<typename T>
+	template<typename TArg>
+	COwnedCallable<T>::COwnedCallable(TArg&& callable) :
+		m_callable(std::forward<TArg>(callable))
+	{
+		mp_callable = &m_callable;
+		m_size = sizeof(COwnedCallable);
+		mp_destroy = &Destroy;
+		mp_clone = CloneFunction(std::is_copy_constructible<T>());
+	}
+
+	template<typename T>
+	void COwnedCallable<T>::Destroy(SOwnedCallable* owned)
+	{
+		COwnedCallable* self = static_cast<COwnedCallable*>(owned);
+		self->~COwnedCallable();
+		CSlabAllocator::Deallocate(self, sizeof(COwnedCallable));
+		CSignalMemory::Remove(sizeof(COwnedCallable));
+	}
+
+	template<typename T>
+	SOwnedCallable* COwnedCallable<T>::Clone(const SOwnedCallable* owned)
+	{
+		return Create(static_cast<const COwnedCallable*>(owned)->m_callable);
+	}
 	
 	// The use of GenericClass comes as the solution to avoid specifying the class type
 	// when defining a signal when we want to store MFP (member function pointer)
@@ -70,6 +287,12 @@ namespace dc
 	class CConnection<ReturnType(Args...)>
 	{
 		friend class CSignal<ReturnType(Args...)>;
+
+		template<typename TEnum, typename Signature, unsigned KeyCount>
+		friend class CSignalTable;
+
+		template<typename TSignature, unsigned HistorySize>
+		friend class CReplaySignal;
 		
 		//------------------------------------------------------------------------------------------------------------------------
 		// Type definitions
@@ -78,8 +301,19 @@ namespace dc
 		// Generic types for functions
 		using TMemberFunctionPtr	= ReturnType (GenericClass::*)(Args...);
 		using TFunctionPtr			= ReturnType (*)(Args...);
+
+		// Observers only get const references to the arguments
+		using TObserverMemberFunctionPtr	= ReturnType (GenericClass::*)(const typename std::decay<Args>::type&...);
+		using TObserverFunctionPtr			= ReturnType (*)(const typename std::decay<Args>::type&...);
+
+		// Tag of the constructors of observers
+		struct SObserver {};
+
+		// Tag of the constructor of the connections forwarding to other signals
+		struct SRelay {};
 		using TConnection			= CConnection<ReturnType(Args...)>;
 		using TSignal				= CSignal<ReturnType(Args...)>;
+		using TBinding				= CSignalBinding<TSignal>;
 		
 		//------------------------------------------------------------------------------------------------------------------------
 		// Getters / Setters
@@ -87,26 +321,47 @@ namespace dc
 	public:
 		const bool IsConnected() const;
 
+		// Object bound to the slot: the caller of a member function, the functor, or null for free functions
+		const void* ObjectAddress() const;
+
+		// Code invoked by the slot: the member function, the invoker of the functor or the free function
+		const void* FunctionAddress() const;
+
 		//------------------------------------------------------------------------------------------------------------------------
 		// Constructors / Destructors
 		//------------------------------------------------------------------------------------------------------------------------
 	public:
 		~CConnection();
 
+		// Copies never own the callable of the connection they copy, they are only handles
 		CConnection(const TConnection& copy);
-		CConnection(TConnection&& copy);
+		CConnection(TConnection&& copy) noexcept;
 
-		TConnection& operator= (const TConnection& moved);
+		TConnection& operator= (const TConnection& copy);
+		TConnection& operator= (TConnection&& moved) noexcept;
 
 	private:
 		template <typename T>
-		CConnection(TSignal* signal, T& ref);
+		CConnection(TBinding* binding, T& ref);
 		
 		template <typename T>
-		CConnection(TSignal* signal, T* functionPtr);
+		CConnection(TBinding* binding, T* functionPtr);
+
+		template <typename TInstance, typename TMemberFunction>
+		CConnection(TBinding* binding, TInstance* instance, TMemberFunction function);
+
+		template <typename T>
+		CConnection(TBinding* binding, COwnedCallable<T>* owned);
+
+		template <typename T>
+		CConnection(TBinding* binding, T& ref, SObserver observer);
+
+		CConnection(TBinding* binding, TObserverFunctionPtr functionPtr, SObserver observer);
 
 		template <typename TInstance, typename TMemberFunction>
-		CConnection(TSignal* signal, TInstance* instance, TMemberFunction function);
+		CConnection(TBinding* binding, TInstance* instance, TMemberFunction function, SObserver observer);
+
+		CConnection(TBinding* binding, TBinding* target, SRelay relay);
 		
 		//------------------------------------------------------------------------------------------------------------------------
 		// Functions
@@ -119,6 +374,9 @@ namespace dc
 	private:
 		ReturnType operator() (Args... args) const;
 
+		// Invokes the slot without copying nor moving the arguments, it must be an observer
+		ReturnType Observe(const typename std::decay<Args>::type&... args) const;
+
 		template <typename TInstance, typename TMemberFunction>
 		void Bind(TInstance* instance, TMemberFunction function);
 
@@ -127,6 +385,11 @@ namespace dc
 		no allocations are involved
 		*/
 		void PassParameters(const TConnection& copy);
+
+		// Takes the ownership of a callable, already bound to the connection through its copy
+		void Own(SOwnedCallable* owned);
+
+		void Release();
 		
 		//------------------------------------------------------------------------------------------------------------------------
 		// Equals to check wether the function passed is the same as the one keeped in the connection
@@ -151,44 +414,99 @@ namespace dc
 
 		// Used when we want to call back free or static functions
 		ReturnType InvokeFunctionPtr(Args... args) const;
+
+		// The same for observers
+		template< typename T>
+		ReturnType InvokeTemplatizedObserver(const typename std::decay<Args>::type&... args) const;
+
+		ReturnType InvokeObserverFunctionPtr(const typename std::decay<Args>::type&... args) const;
+
+		// Used when forwarding to another signal, when the relay chain can't be flattened
+		ReturnType InvokeRelay(Args... args) const;
+
+		// Binding of the signal a relay connection forwards to
+		TBinding* RelayTarget() const { return reinterpret_cast<TBinding*>(mp_function); }
+
+		const bool IsFreeFunction() const;
 		
 		void Clear();
 
 	private:
-		TSignal*			mp_bindedSignal;
+		TBinding*			mp_binding;
 		
 		GenericClass*		mp_caller;
 		TMemberFunctionPtr	mp_memberFunction;
 		
 		TFunctionPtr		mp_function;
+
+		// Only set in the connection stored by the signal
+		SOwnedCallable*		mp_owned;
+
+		// One-shot connections are marked as consumed when dispatched and removed by the signal after the emission
+		bool				m_isOneShot;
+		mutable bool		m_isConsumed;
+
+		// mp_memberFunction is really a TObserverMemberFunctionPtr
+		bool				m_isObserver;
+
+		// Forwards to the signal of the binding in mp_function
+		bool				m_isRelay;
 	};
 
 	template <typename ReturnType, typename... Args>
 	const bool CConnection<ReturnType(Args...)>::IsConnected() const
 	{
-		const bool hasMFP = mp_bindedSignal && mp_caller && mp_memberFunction;
+		const bool hasMFP = mp_binding && mp_caller && mp_memberFunction;
 		const bool hasFP = mp_function && hasMFP;
 
 		// mp_function is not zero only when you connect a free or static function
 		return hasFP || hasMFP;
 	}
 
+	template <typename ReturnType, typename... Args>
+	const void* CConnection<ReturnType(Args...)>::ObjectAddress() const
+	{
+		if (!mp_function) return mp_caller;
+
+		return IsFreeFunction() ? 0 : reinterpret_cast<const void*>(mp_function);
+	}
+
+	template <typename ReturnType, typename... Args>
+	const void* CConnection<ReturnType(Args...)>::FunctionAddress() const
+	{
+		if (IsFreeFunction()) return reinterpret_cast<const void*>(mp_function);
+
+		// For non virtual functions the code address is the first word of the member function pointer
+		// in the common ABIs
+		const void* address = 0;
+		std::memcpy(&address, &mp_memberFunction, sizeof(address));
+		return address;
+	}
+
 	template <typename ReturnType, typename... Args>
 	CConnection<ReturnType(Args...)>::~CConnection()
 	{
+		Release();
 		Clear();
 	}
 
 	template <typename ReturnType, typename... Args>
-	CConnection<ReturnType(Args...)>::CConnection(const TConnection& copy)
+	CConnection<ReturnType(Args...)>::CConnection(const TConnection& copy) :
+		mp_owned(0)
 	{
 		PassParameters(copy);
 	}
 
 	template <typename ReturnType, typename... Args>
-	CConnection<ReturnType(Args...)>::CConnection(TConnection&& moved)
+	CConnection<ReturnType(Args...)>::CConnection(TConnection&& moved) noexcept
 	{
-		mp_bindedSignal = std::move(moved.mp_bindedSignal);
+		mp_owned = moved.mp_owned;
+		moved.mp_owned = 0;
+		mp_binding = std::move(moved.mp_binding);
+		m_isOneShot = moved.m_isOneShot;
+		m_isConsumed = moved.m_isConsumed;
+		m_isObserver = moved.m_isObserver;
+		m_isRelay = moved.m_isRelay;
 		if (moved.mp_function)
 		{
 			mp_function = std::move(moved.mp_function);
@@ -204,17 +522,37 @@ namespace dc
 	template <typename ReturnType, typename... Args>
 	CConnection<ReturnType(Args...)>& CConnection<ReturnType(Args...)>::operator= (const TConnection& copy)
 	{
+		if (this == &copy) return *this;
+
+		Release();
 		PassParameters(copy);
 		return *this;
 	}
 
+	template <typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CConnection<ReturnType(Args...)>::operator= (TConnection&& moved) noexcept
+	{
+		if (this == &moved) return *this;
+
+		Release();
+		PassParameters(moved);
+		mp_owned = moved.mp_owned;
+		moved.mp_owned = 0;
+		return *this;
+	}
+
 	template <typename ReturnType, typename... Args>
 	template <typename T>
-	CConnection<ReturnType(Args...)>::CConnection(TSignal* signal, T& ref) :
-		mp_bindedSignal(signal),
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, T& ref) :
+		mp_binding(binding),
 		mp_caller(0),
 		mp_memberFunction(0),
-		mp_function(0)
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(false),
+		m_isRelay(false)
 
 	{
 		mp_function = reinterpret_cast<TFunctionPtr>(&ref);
@@ -223,11 +561,16 @@ namespace dc
 
 	template <typename ReturnType, typename... Args>
 	template <typename T>
-	CConnection<ReturnType(Args...)>::CConnection(TSignal* signal, T* functionPtr) :
-		mp_bindedSignal(signal),
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, T* functionPtr) :
+		mp_binding(binding),
 		mp_caller(0),
 		mp_memberFunction(0),
-		mp_function(0)
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(false),
+		m_isRelay(false)
 
 	{
 		mp_function = functionPtr;
@@ -236,20 +579,110 @@ namespace dc
 
 	template <typename ReturnType, typename... Args>
 	template <typename TInstance, typename TMemberFunction>
-	CConnection<ReturnType(Args...)>::CConnection(TSignal* signal, TInstance* instance, TMemberFunction function) :
-		mp_bindedSignal(signal),
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, TInstance* instance, TMemberFunction function) :
+		mp_binding(binding),
 		mp_caller(0),
 		mp_memberFunction(0),
-		mp_function(0)
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(false),
+		m_isRelay(false)
 	{
 		Bind(instance, function);
 	}
 
+	template <typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, COwnedCallable<T>* owned) :
+		mp_binding(binding),
+		mp_caller(0),
+		mp_memberFunction(0),
+		mp_function(0),
+		mp_owned(owned),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(false),
+		m_isRelay(false)
+	{
+		mp_function = reinterpret_cast<TFunctionPtr>(&owned->Callable());
+		Bind(this, &CConnection::InvokeTemplatizedFunctionPtr<T>);
+	}
+
+	template <typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, T& ref, SObserver observer) :
+		mp_binding(binding),
+		mp_caller(0),
+		mp_memberFunction(0),
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(true),
+		m_isRelay(false)
+	{
+		mp_function = reinterpret_cast<TFunctionPtr>(&ref);
+		Bind(this, &CConnection::InvokeTemplatizedObserver<T>);
+	}
+
+	template <typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, TObserverFunctionPtr functionPtr, SObserver observer) :
+		mp_binding(binding),
+		mp_caller(0),
+		mp_memberFunction(0),
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(true),
+		m_isRelay(false)
+	{
+		mp_function = reinterpret_cast<TFunctionPtr>(functionPtr);
+		Bind(this, &CConnection::InvokeObserverFunctionPtr);
+	}
+
+	template <typename ReturnType, typename... Args>
+	template <typename TInstance, typename TMemberFunction>
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, TInstance* instance, TMemberFunction function, SObserver observer) :
+		mp_binding(binding),
+		mp_caller(0),
+		mp_memberFunction(0),
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(true),
+		m_isRelay(false)
+	{
+		Bind(instance, function);
+	}
+
+	template <typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>::CConnection(TBinding* binding, TBinding* target, SRelay relay) :
+		mp_binding(binding),
+		mp_caller(0),
+		mp_memberFunction(0),
+		mp_function(0),
+		mp_owned(0),
+		m_isOneShot(false),
+		m_isConsumed(false),
+		m_isObserver(false),
+		m_isRelay(true)
+	{
+		mp_function = reinterpret_cast<TFunctionPtr>(target);
+		Bind(this, &CConnection::InvokeRelay);
+	}
+
 	template <typename ReturnType, typename... Args>
 	void CConnection<ReturnType(Args...)>::Disconnect()
 	{
 		// We need to dereference ourselves to properly use the disconnection
-		mp_bindedSignal->Disconnect(*this);
+		if (mp_binding && mp_binding->mp_signal)
+		{
+			mp_binding->mp_signal->Disconnect(*this);
+		}
 		Clear();
 	}
 
@@ -259,7 +692,7 @@ namespace dc
 		if (this == &connection) return true;
 		if (mp_caller == connection.mp_caller) return true;
 
-		return mp_bindedSignal == connection.mp_bindedSignal
+		return mp_binding == connection.mp_binding
 			&& mp_function == connection.mp_function
 			&& mp_memberFunction == connection.mp_memberFunction;
 	}
@@ -267,8 +700,17 @@ namespace dc
 	template <typename ReturnType, typename... Args>
 	ReturnType CConnection<ReturnType(Args...)>::operator() (Args... args) const
 	{
+		if (m_isObserver) return Observe(args...);
+
 		// Here is the reason why we need 'm_pCaller' to be of a generic class type, so it is compatible with the right hand operand '->*'
-		return (mp_caller->*mp_memberFunction)(args...);
+		return (mp_caller->*mp_memberFunction)(std::forward<Args>(args)...);
+	}
+
+	template <typename ReturnType, typename... Args>
+	ReturnType CConnection<ReturnType(Args...)>::Observe(const typename std::decay<Args>::type&... args) const
+	{
+		assert(m_isObserver);
+		return (mp_caller->*reinterpret_cast<TObserverMemberFunctionPtr>(mp_memberFunction))(args...);
 	}
 
 	template <typename ReturnType, typename... Args>
@@ -289,7 +731,11 @@ namespace dc
 	template <typename ReturnType, typename... Args>
 	void CConnection<ReturnType(Args...)>::PassParameters(const TConnection& copy)
 	{
-		mp_bindedSignal = copy.mp_bindedSignal;
+		mp_binding = copy.mp_binding;
+		m_isOneShot = copy.m_isOneShot;
+		m_isConsumed = copy.m_isConsumed;
+		m_isObserver = copy.m_isObserver;
+		m_isRelay = copy.m_isRelay;
 		if (copy.mp_function)
 		{
 			mp_function = copy.mp_function;
@@ -302,6 +748,23 @@ namespace dc
 		}
 	}
 
+	template <typename ReturnType, typename... Args>
+	void CConnection<ReturnType(Args...)>::Own(SOwnedCallable* owned)
+	{
+		assert(!mp_owned && mp_function);
+		mp_owned = owned;
+		mp_function = reinterpret_cast<TFunctionPtr>(owned->mp_callable);
+	}
+
+	template <typename ReturnType, typename... Args>
+	void CConnection<ReturnType(Args...)>::Release()
+	{
+		if (!mp_owned) return;
+
+		mp_owned->mp_destroy(mp_owned);
+		mp_owned = 0;
+	}
+
 	template <typename ReturnType, typename... Args>
 	template <typename T, typename TMemberFunction>
 	const bool CConnection<ReturnType(Args...)>::Equals(T* caller, TMemberFunction function) const
@@ -329,21 +792,54 @@ namespace dc
 	template< typename T>
 	ReturnType CConnection<ReturnType(Args...)>::InvokeTemplatizedFunctionPtr(Args... args) const
 	{
-		return (reinterpret_cast<T*>(mp_function)->operator())(args...);
+		return (reinterpret_cast<T*>(mp_function)->operator())(std::forward<Args>(args)...);
 	}
 
 	template <typename ReturnType, typename... Args>
 	ReturnType CConnection<ReturnType(Args...)>::InvokeFunctionPtr(Args... args) const
 	{
-		return (*mp_function)(args...);
+		return (*mp_function)(std::forward<Args>(args)...);
+	}
+
+	template <typename ReturnType, typename... Args>
+	template< typename T>
+	ReturnType CConnection<ReturnType(Args...)>::InvokeTemplatizedObserver(const typename std::decay<Args>::type&... args) const
+	{
+		return (reinterpret_cast<T*>(mp_function)->operator())(args...);
+	}
+
+	template <typename ReturnType, typename... Args>
+	ReturnType CConnection<ReturnType(Args...)>::InvokeObserverFunctionPtr(const typename std::decay<Args>::type&... args) const
+	{
+		return (*reinterpret_cast<TObserverFunctionPtr>(mp_function))(args...);
+	}
+
+	template <typename ReturnType, typename... Args>
+	ReturnType CConnection<ReturnType(Args...)>::InvokeRelay(Args... args) const
+	{
+		// Only signals returning void can be forwarded
+		(*RelayTarget()->mp_signal)(args...);
+		return ReturnType();
+	}
+
+	template <typename ReturnType, typename... Args>
+	const bool CConnection<ReturnType(Args...)>::IsFreeFunction() const
+	{
+		return mp_function
+			&& (mp_memberFunction == reinterpret_cast<TMemberFunctionPtr>(&CConnection::InvokeFunctionPtr)
+			|| mp_memberFunction == reinterpret_cast<TMemberFunctionPtr>(&CConnection::InvokeObserverFunctionPtr));
 	}
 
 	template <typename ReturnType, typename... Args>
 	void CConnection<ReturnType(Args...)>::Clear()
 	{
-		mp_bindedSignal = 0;
+		mp_binding = 0;
 		mp_caller = 0;
 		mp_memberFunction = 0;
 		mp_function = 0;
+		m_isOneShot = false;
+		m_isConsumed = false;
+		m_isObserver = false;
+		m_isRelay = false;
 	}
 } /* namespace dc */
@@ -0,0 +1,231 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * coroutine.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include "signal.h"
+
+// Only available when compiling as C++20 or later with coroutines support
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <optional>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dc
+{
+	namespace detail
+	{
+		// Value a coroutine receives when the signal it awaits is emitted: nothing, the argument or a tuple of them
+		template<typename... Args>
+		struct TAwaitedValue
+		{
+			using TType = std::tuple<std::decay_t<Args>...>;
+			using TStored = TType;
+
+			template<typename TArguments>
+			static TStored Store(TArguments& arguments) { return TStored(arguments); }
+
+			static TType Take(TStored& stored) { return std::move(stored); }
+		};
+
+		template<typename Arg>
+		struct TAwaitedValue<Arg>
+		{
+			using TType = std::decay_t<Arg>;
+			using TStored = TType;
+
+			template<typename TArguments>
+			static TStored Store(TArguments& arguments) { return TStored(std::get<0>(arguments)); }
+
+			static TType Take(TStored& stored) { return std::move(stored); }
+		};
+
+		template<>
+		struct TAwaitedValue<>
+		{
+			using TType = void;
+			using TStored = bool;
+
+			template<typename TArguments>
+			static TStored Store(TArguments& arguments) { return true; }
+
+			static void Take(TStored& stored) {}
+		};
+	}
+
+	/*
+	 CSIGNALAWAITER
+
+	 Result of co_await on a signal: suspends the coroutine until the next emission and resumes it, inside that
+	 emission and after the slots, with a copy of the arguments. The awaiter lives in the frame of the coroutine
+	 and is itself the node linked in the signal, so awaiting doesn't allocate.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CSignalAwaiter<CSignal<ReturnType(Args...)>> : private SSignalWaiter
+	{
+		static_assert(detail::TAreCopyable<Args...>::value, "Signals with arguments that can't be copied can't be awaited, their sink takes them");
+
+	private:
+		using TSignal		= CSignal<ReturnType(Args...)>;
+		using TAwaitedValue	= detail::TAwaitedValue<Args...>;
+		using TArguments	= std::tuple<std::add_lvalue_reference_t<Args>...>;
+
+	public:
+		explicit CSignalAwaiter(TSignal& signal);
+
+		~CSignalAwaiter();
+
+	private:
+		CSignalAwaiter(const CSignalAwaiter& copy) = delete;
+		CSignalAwaiter& operator= (const CSignalAwaiter& copy) = delete;
+
+	public:
+		const bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle);
+
+		typename TAwaitedValue::TType await_resume() { return TAwaitedValue::Take(*m_value); }
+
+	private:
+		static void Notify(SSignalWaiter* waiter, void* arguments);
+
+	private:
+		TSignal*									mp_signal;
+		std::coroutine_handle<>						m_handle;
+		std::optional<typename TAwaitedValue::TStored>	m_value;
+	};
+
+	template<typename ReturnType, typename... Args>
+	CSignalAwaiter<CSignal<ReturnType(Args...)>>::CSignalAwaiter(TSignal& signal) :
+		mp_signal(&signal)
+	{
+		mp_next = 0;
+		mp_list = 0;
+		mp_notify = &Notify;
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignalAwaiter<CSignal<ReturnType(Args...)>>::~CSignalAwaiter()
+	{
+		// The coroutine was destroyed while waiting, unlinking it
+		if (!mp_list) return;
+
+		SSignalWaiter** link = mp_list;
+		while (*link != this)
+		{
+			link = &(*link)->mp_next;
+		}
+		*link = mp_next;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignalAwaiter<CSignal<ReturnType(Args...)>>::await_suspend(std::coroutine_handle<> handle)
+	{
+		m_handle = handle;
+
+		SSignalWaiter*& waiters = mp_signal->Binding()->mp_waiters;
+		mp_next = waiters;
+		mp_list = &waiters;
+		waiters = this;
+
+		// The signal must dispatch its emissions itself to wake up the waiter, it can't be flattened
+		mp_signal->Invalidate();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignalAwaiter<CSignal<ReturnType(Args...)>>::Notify(SSignalWaiter* waiter, void* arguments)
+	{
+		CSignalAwaiter* self = static_cast<CSignalAwaiter*>(waiter);
+		self->m_value.emplace(TAwaitedValue::Store(*static_cast<TArguments*>(arguments)));
+
+		// The awaiter can be destroyed by the coroutine from here
+		self->m_handle.resume();
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignalAwaiter<CSignal<ReturnType(Args...)>> operator co_await(CSignal<ReturnType(Args...)>& signal)
+	{
+		return CSignalAwaiter<CSignal<ReturnType(Args...)>>(signal);
+	}
+
+	/*
+	 CSLOTTASK
+
+	 Return type of the coroutines connected as slots. They start running when the slot is invoked, and
+	 their frame is destroyed when they finish, nobody waits for them.
+	 */
+	class CSlotTask
+	{
+	public:
+		struct promise_type
+		{
+			CSlotTask get_return_object() noexcept { return CSlotTask(); }
+
+			std::suspend_never initial_suspend() noexcept { return {}; }
+
+			std::suspend_never final_suspend() noexcept { return {}; }
+
+			void return_void() noexcept {}
+
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	/*
+	 CCOROUTINESLOT
+
+	 Adapts a coroutine returning CSlotTask to a slot returning nothing
+	 */
+	template<typename T>
+	class CCoroutineSlot
+	{
+	public:
+		template<typename TArg>
+		explicit CCoroutineSlot(TArg&& coroutine) : m_coroutine(std::forward<TArg>(coroutine)) {}
+
+	public:
+		template<typename... TArgs>
+		void operator()(TArgs&&... args) { m_coroutine(std::forward<TArgs>(args)...); }
+
+	private:
+		T m_coroutine;
+	};
+
+	/*
+	 Connects a coroutine as an owned slot of the signal. The coroutine should take its parameters by value,
+	 the arguments of the emission are gone once it suspends.
+	 The captures of a lambda coroutine aren't copied into its frame, the frame refers to the closure kept in
+	 the connection. If the slot is disconnected or the signal destroyed while the coroutine is suspended,
+	 it resumes with a dangling closure: the captures can only be used while the connection lives, so a slot
+	 that may outlive it should be captureless and pass what it needs as parameters of a coroutine function.
+	 */
+	template<typename ReturnType, typename... Args, typename T>
+	CConnection<ReturnType(Args...)>& ConnectCoroutine(CSignal<ReturnType(Args...)>& signal, T&& coroutine)
+	{
+		static_assert(std::is_void<ReturnType>::value, "Coroutine slots can't return values");
+
+		return signal.ConnectOwned(CCoroutineSlot<std::decay_t<T>>(std::forward<T>(coroutine)));
+	}
+}
+
+#endif
@@ -0,0 +1,464 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * emission_log.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <memory>
+#include <algorithm>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "signal.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	/*
+	 Encoding of the arguments in the emission logs. The default one copies the bytes of trivially copyable
+	 types, other types need their own specialization with the same functions.
+	 Decode reads from the cursor without passing the end of the record, returning false when the bytes left
+	 aren't enough for the value.
+	 */
+	template<typename T>
+	struct TSignalCodec
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Arguments that aren't trivially copyable need a TSignalCodec specialization");
+
+		static const std::size_t Size(const T& value) { return sizeof(T); }
+
+		static void Encode(const T& value, char*& cursor)
+		{
+			memcpy(cursor, &value, sizeof(T));
+			cursor += sizeof(T);
+		}
+
+		static const bool Decode(const char*& cursor, const char* end, T& value)
+		{
+			if (static_cast<std::size_t>(end - cursor) < sizeof(T)) return false;
+
+			memcpy(&value, cursor, sizeof(T));
+			cursor += sizeof(T);
+			return true;
+		}
+	};
+
+	namespace detail
+	{
+		// Layout of the log files: the header followed by the records, every one aligned to 8 bytes
+		struct SEmissionLogHeader
+		{
+			char		m_magic[4];
+			uint32_t	m_version;
+			uint64_t	m_size;
+		};
+
+		struct SEmissionRecord
+		{
+			uint32_t	m_channel;
+			uint32_t	m_size;
+		};
+
+		static const uint32_t kEmissionLogVersion = 1;
+
+		// The replayer indexes its bindings by channel, so the channels are kept below this
+		static const uint32_t kMaxEmissionChannels = 1024;
+
+		inline const std::size_t AlignRecord(const std::size_t size) { return (size + 7) & ~std::size_t(7); }
+	}
+
+	/*
+	 CEMISSIONRECORDER
+
+	 Appends the emissions of the signals recorded to a memory-mapped file. Every emission becomes a record
+	 with the channel of its signal, the size of the arguments and the arguments encoded with TSignalCodec.
+	 The file grows by doubling its mapping and is truncated to the records written when the recorder is closed.
+	 The emissions that don't fit when the file can't grow are dropped, recording goes on with the next ones.
+	 The recorder is an observer of the signals, which must outlive it, and it isn't thread safe.
+	 */
+	class CEmissionRecorder
+	{
+	private:
+		class CChannel
+		{
+		public:
+			virtual ~CChannel() {}
+
+			virtual void Disconnect() = 0;
+		};
+
+		template<typename... Args>
+		class CSignalChannel : public CChannel
+		{
+		public:
+			using TSignal = CSignal<void(Args...)>;
+
+		public:
+			CSignalChannel(CEmissionRecorder* recorder, const uint32_t channel, TSignal& signal) :
+				mp_recorder(recorder),
+				mp_signal(&signal),
+				m_channel(channel)
+			{
+				signal.ConnectObserver(this, &CSignalChannel::Write);
+			}
+
+		public:
+			// The later connections of the signal move its connection, so it's found by the channel instead
+			void Disconnect() override { mp_signal->DisconnectObserver(this, &CSignalChannel::Write); }
+
+			void Write(const typename std::decay<Args>::type&... args);
+
+		private:
+			CEmissionRecorder*					mp_recorder;
+			TSignal*							mp_signal;
+			uint32_t							m_channel;
+		};
+
+	public:
+		explicit CEmissionRecorder(const char* path, const std::size_t initialCapacity = 64 * 1024);
+
+		~CEmissionRecorder() { Close(); }
+
+	private:
+		CEmissionRecorder(const CEmissionRecorder& copy) = delete;
+		CEmissionRecorder& operator= (const CEmissionRecorder& copy) = delete;
+
+	public:
+		const bool IsOpen() const { return mp_mapping != 0; }
+
+		// Records the emissions of the signal with the channel, which identifies it when replaying. The channel
+		// must be below detail::kMaxEmissionChannels
+		template<typename... Args>
+		const bool Record(CSignal<void(Args...)>& signal, const uint32_t channel);
+
+		// Stops recording and truncates the file to the records written
+		void Close();
+
+		// Bytes of the records written
+		const std::size_t Size() const { return IsOpen() ? Header().m_size : 0; }
+
+	private:
+		// Reserves a record and returns where its arguments go
+		char* Append(const uint32_t channel, const std::size_t size);
+
+		const bool Map(const std::size_t capacity);
+
+		detail::SEmissionLogHeader& Header() const { return *reinterpret_cast<detail::SEmissionLogHeader*>(mp_mapping); }
+
+	private:
+		std::vector<std::unique_ptr<CChannel>>	m_channels;
+		char*									mp_mapping;
+		std::size_t								m_capacity;
+		int										m_file;
+	};
+
+	/*
+	 CEMISSIONREPLAYER
+
+	 Reads an emission log and emits its records, in the order they were recorded, in the signals bound to
+	 their channels. Records of channels without a signal are skipped, like the ones whose arguments don't
+	 decode to the exact size of the record, which happens when the signal bound has another signature.
+	 The arguments are decoded in default constructed values.
+	 */
+	class CEmissionReplayer
+	{
+	private:
+		struct SBinding
+		{
+			SBinding() : mp_signal(0), mp_emit(0) {}
+
+			void*		mp_signal;
+			const bool	(*mp_emit)(void* signal, const char* arguments, const std::size_t size);
+		};
+
+	public:
+		explicit CEmissionReplayer(const char* path);
+
+		~CEmissionReplayer();
+
+	private:
+		CEmissionReplayer(const CEmissionReplayer& copy) = delete;
+		CEmissionReplayer& operator= (const CEmissionReplayer& copy) = delete;
+
+	public:
+		const bool IsOpen() const { return mp_mapping != 0; }
+
+		// Returns false if the channel isn't below detail::kMaxEmissionChannels
+		template<typename... Args>
+		const bool Bind(CSignal<void(Args...)>& signal, const uint32_t channel);
+
+		// Emits the next record, returns false at the end of the log
+		const bool Next();
+
+		// Emits the records left and returns how many were read
+		const unsigned Replay();
+
+		// Records read whose arguments couldn't be decoded
+		const unsigned RejectedCount() const { return m_rejectedCount; }
+
+		// Starts again from the first record
+		void Rewind() { m_offset = sizeof(detail::SEmissionLogHeader); }
+
+	private:
+		template<typename... Args>
+		static const bool Emit(void* signal, const char* arguments, const std::size_t size);
+
+		template<typename... Args, unsigned... Indices>
+		static const bool Decode(const char*& cursor, const char* end, std::tuple<Args...>& arguments, detail::TIndexSequence<Indices...>)
+		{
+			// The braced initialization decodes them in order, the ones after a failure have no bytes left
+			const bool decoded[] = { true, TSignalCodec<Args>::Decode(cursor, end, std::get<Indices>(arguments))... };
+			for (const bool isDecoded : decoded)
+			{
+				if (!isDecoded) return false;
+			}
+			return true;
+		}
+
+		template<typename... Args, unsigned... Indices>
+		static void EmitDecoded(CSignal<void(Args...)>& signal, std::tuple<typename std::decay<Args>::type...>& arguments, detail::TIndexSequence<Indices...>)
+		{
+			signal(std::move(std::get<Indices>(arguments))...);
+		}
+
+	private:
+		std::vector<SBinding>	m_bindings;
+		const char*				mp_mapping;
+		std::size_t				m_mappingSize;
+		std::size_t				m_end;
+		std::size_t				m_offset;
+		unsigned				m_rejectedCount;
+	};
+
+	template<typename... Args>
+	void CEmissionRecorder::CSignalChannel<Args...>::Write(const typename std::decay<Args>::type&... args)
+	{
+		const std::size_t sizes[] = { 0, TSignalCodec<typename std::decay<Args>::type>::Size(args)... };
+		std::size_t size = 0;
+		for (const std::size_t argumentSize : sizes) size += argumentSize;
+
+		char* cursor = mp_recorder->Append(m_channel, size);
+		if (!cursor) return;
+
+		// The braced initialization encodes them in order
+		const int order[] = { 0, (TSignalCodec<typename std::decay<Args>::type>::Encode(args, cursor), 0)... };
+		(void)order;
+	}
+
+	inline CEmissionRecorder::CEmissionRecorder(const char* path, const std::size_t initialCapacity) :
+		mp_mapping(0),
+		m_capacity(0),
+		m_file(open(path, O_RDWR | O_CREAT | O_TRUNC, 0644))
+	{
+		if (m_file < 0) return;
+
+		if (!Map(detail::AlignRecord(std::max(initialCapacity, sizeof(detail::SEmissionLogHeader)))))
+		{
+			close(m_file);
+			m_file = -1;
+			return;
+		}
+
+		detail::SEmissionLogHeader& header = Header();
+		memcpy(header.m_magic, "DCEL", 4);
+		header.m_version = detail::kEmissionLogVersion;
+		header.m_size = 0;
+	}
+
+	template<typename... Args>
+	const bool CEmissionRecorder::Record(CSignal<void(Args...)>& signal, const uint32_t channel)
+	{
+		if (!IsOpen() || channel >= detail::kMaxEmissionChannels) return false;
+
+		m_channels.push_back(std::unique_ptr<CChannel>(new CSignalChannel<Args...>(this, channel, signal)));
+		return true;
+	}
+
+	inline void CEmissionRecorder::Close()
+	{
+		for (const std::unique_ptr<CChannel>& channel : m_channels)
+		{
+			channel->Disconnect();
+		}
+		m_channels.clear();
+
+		if (IsOpen())
+		{
+			const std::size_t size = sizeof(detail::SEmissionLogHeader) + Header().m_size;
+			munmap(mp_mapping, m_capacity);
+			mp_mapping = 0;
+
+			const int result = ftruncate(m_file, size);
+			(void)result;
+		}
+
+		if (m_file >= 0)
+		{
+			close(m_file);
+			m_file = -1;
+		}
+	}
+
+	inline char* CEmissionRecorder::Append(const uint32_t channel, const std::size_t size)
+	{
+		if (!IsOpen()) return 0;
+
+		const std::size_t offset = sizeof(detail::SEmissionLogHeader) + Header().m_size;
+		const std::size_t recordSize = sizeof(detail::SEmissionRecord) + detail::AlignRecord(size);
+
+		std::size_t capacity = m_capacity;
+		while (offset + recordSize > capacity) capacity *= 2;
+		if (capacity != m_capacity && !Map(capacity)) return 0;
+
+		char* record = mp_mapping + offset;
+		detail::SEmissionRecord header = { channel, static_cast<uint32_t>(size) };
+		memcpy(record, &header, sizeof(header));
+		Header().m_size += recordSize;
+		return record + sizeof(header);
+	}
+
+	inline const bool CEmissionRecorder::Map(const std::size_t capacity)
+	{
+		if (ftruncate(m_file, capacity) != 0) return false;
+
+		// The records already written stay in the file, mapping it again from the start. The old mapping is
+		// kept until the new one succeeds, so a failure only drops the record that didn't fit
+		void* mapping = mmap(0, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+		if (mapping == MAP_FAILED) return false;
+
+		if (mp_mapping)
+		{
+			munmap(mp_mapping, m_capacity);
+		}
+		mp_mapping = static_cast<char*>(mapping);
+		m_capacity = capacity;
+		return true;
+	}
+
+	inline CEmissionReplayer::CEmissionReplayer(const char* path) :
+		mp_mapping(0),
+		m_mappingSize(0),
+		m_end(0),
+		m_offset(sizeof(detail::SEmissionLogHeader)),
+		m_rejectedCount(0)
+	{
+		const int file = open(path, O_RDONLY);
+		if (file < 0) return;
+
+		struct stat status;
+		if (fstat(file, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(detail::SEmissionLogHeader))
+		{
+			void* mapping = mmap(0, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+			if (mapping != MAP_FAILED)
+			{
+				mp_mapping = static_cast<const char*>(mapping);
+				m_mappingSize = status.st_size;
+			}
+		}
+		close(file);
+
+		if (!mp_mapping) return;
+
+		// Rejecting other files, and logs cut while recording are read up to their last complete record
+		detail::SEmissionLogHeader header;
+		memcpy(&header, mp_mapping, sizeof(header));
+		if (memcmp(header.m_magic, "DCEL", 4) != 0 || header.m_version != detail::kEmissionLogVersion)
+		{
+			munmap(const_cast<char*>(mp_mapping), m_mappingSize);
+			mp_mapping = 0;
+			return;
+		}
+		m_end = std::min<std::size_t>(sizeof(header) + header.m_size, m_mappingSize);
+	}
+
+	inline CEmissionReplayer::~CEmissionReplayer()
+	{
+		if (mp_mapping)
+		{
+			munmap(const_cast<char*>(mp_mapping), m_mappingSize);
+		}
+	}
+
+	template<typename... Args>
+	const bool CEmissionReplayer::Bind(CSignal<void(Args...)>& signal, const uint32_t channel)
+	{
+		if (channel >= detail::kMaxEmissionChannels) return false;
+
+		if (channel >= m_bindings.size())
+		{
+			m_bindings.resize(channel + 1);
+		}
+		m_bindings[channel].mp_signal = &signal;
+		m_bindings[channel].mp_emit = &CEmissionReplayer::Emit<Args...>;
+		return true;
+	}
+
+	inline const bool CEmissionReplayer::Next()
+	{
+		if (!mp_mapping || m_offset + sizeof(detail::SEmissionRecord) > m_end) return false;
+
+		detail::SEmissionRecord record;
+		memcpy(&record, mp_mapping + m_offset, sizeof(record));
+
+		const std::size_t recordSize = sizeof(record) + detail::AlignRecord(record.m_size);
+		if (m_offset + recordSize > m_end) return false;
+
+		const char* arguments = mp_mapping + m_offset + sizeof(record);
+		m_offset += recordSize;
+
+		if (record.m_channel < m_bindings.size() && m_bindings[record.m_channel].mp_emit)
+		{
+			const SBinding& binding = m_bindings[record.m_channel];
+			if (!binding.mp_emit(binding.mp_signal, arguments, record.m_size)) ++m_rejectedCount;
+		}
+		return true;
+	}
+
+	inline const unsigned CEmissionReplayer::Replay()
+	{
+		unsigned count = 0;
+		while (Next()) ++count;
+		return count;
+	}
+
+	template<typename... Args>
+	const bool CEmissionReplayer::Emit(void* signal, const char* arguments, const std::size_t size)
+	{
+		using TArguments = std::tuple<typename std::decay<Args>::type...>;
+
+		const char* end = arguments + size;
+		TArguments decoded;
+		if (!Decode(arguments, end, decoded, typename detail::TMakeIndexSequence<sizeof...(Args)>::TType()) || arguments != end) return false;
+
+		EmitDecoded(*static_cast<CSignal<void(Args...)>*>(signal), decoded, typename detail::TMakeIndexSequence<sizeof...(Args)>::TType());
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,221 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_bus.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include "signal.h"
+
+namespace dc
+{
+	using TTopicId = unsigned long long;
+
+	namespace detail
+	{
+		constexpr TTopicId FNV1a(const char* name, const TTopicId hash)
+		{
+			return *name ? FNV1a(name + 1, (hash ^ static_cast<unsigned char>(*name)) * 1099511628211ull) : hash;
+		}
+
+		constexpr TTopicId NonZero(const TTopicId hash)
+		{
+			return hash ? hash : 1;
+		}
+	}
+
+	/*
+	 Hashes a topic name into its id (64 bits FNV-1a). It is constexpr, so ids of known topics can be
+	 computed at compile time. The id 0 is reserved to mark empty entries in the bus, the raw ids given to
+	 the bus are remapped like the hashes, so 0 is the same topic than 1.
+	 */
+	constexpr TTopicId HashTopic(const char* name)
+	{
+		return detail::NonZero(detail::FNV1a(name, 14695981039346656037ull));
+	}
+
+	template<typename Signature>
+	class CEventBus;
+
+	/*
+	 CEVENTBUS
+
+	 Signals indexed by topic. Producers and consumers meet by topic name, but names are hashed once into
+	 ids (see HashTopic), so publishing is a lookup in a flat open-addressing table followed by a
+	 normal emission. Two names with the same hash would share the same signal.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CEventBus<ReturnType(Args...)>
+	{
+		//---------------------------------------------------------------------
+		// Type definitions
+		//---------------------------------------------------------------------
+	public:
+		using TSignal = CSignal<ReturnType(Args...)>;
+		using TConnection = CConnection<ReturnType(Args...)>;
+
+	private:
+		struct STopic
+		{
+			STopic() : id(0) {}
+
+			TTopicId					id;
+			std::unique_ptr<TSignal>	signal;
+		};
+
+		//---------------------------------------------------------------------
+		// Getters / Setters
+		//---------------------------------------------------------------------
+	public:
+		const unsigned	TopicCount() const	{ return m_topicCount; }
+
+		//---------------------------------------------------------------------
+		// Constructors / Destructors
+		//---------------------------------------------------------------------
+	public:
+		CEventBus() : m_topicCount(0) {}
+
+		//---------------------------------------------------------------------
+		// Functions
+		//---------------------------------------------------------------------
+	public:
+		// Returns the signal of the topic, registering it if needed
+		TSignal& Topic(const TTopicId topic);
+
+		TSignal& Topic(const char* name) { return Topic(HashTopic(name)); }
+
+		// Returns the signal of the topic or null if it was never registered
+		TSignal* Find(const TTopicId topic);
+
+		const TSignal* Find(const TTopicId topic) const;
+
+		template<typename... TSlot>
+		TConnection& Subscribe(const TTopicId topic, TSlot&&... slot)
+		{
+			return Topic(topic).Connect(std::forward<TSlot>(slot)...);
+		}
+
+		template<typename... TSlot>
+		void Unsubscribe(const TTopicId topic, TSlot&&... slot)
+		{
+			if (TSignal* signal = Find(topic))
+			{
+				signal->Disconnect(std::forward<TSlot>(slot)...);
+			}
+		}
+
+		// Emits the signal of the topic. Returns false if nobody registered the topic.
+		const bool Publish(const TTopicId topic, Args... args);
+
+		void Clear();
+
+	private:
+		const unsigned Probe(const TTopicId topic) const;
+
+		void Grow();
+
+	private:
+		// Power of two sized, linear probing
+		std::vector<STopic> m_topics;
+
+		unsigned m_topicCount;
+	};
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>& CEventBus<ReturnType(Args...)>::Topic(const TTopicId topic)
+	{
+		if (TSignal* signal = Find(topic))
+		{
+			return *signal;
+		}
+
+		// Keeping the load factor under 1/2 so the probes stay short
+		if ((m_topicCount + 1) * 2 > m_topics.size())
+		{
+			Grow();
+		}
+
+		STopic& entry = m_topics[Probe(topic)];
+		entry.id = detail::NonZero(topic);
+		entry.signal.reset(new TSignal());
+		++m_topicCount;
+		return *entry.signal;
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>* CEventBus<ReturnType(Args...)>::Find(const TTopicId topic)
+	{
+		if (m_topics.empty()) return 0;
+
+		STopic& entry = m_topics[Probe(topic)];
+		return entry.signal.get();
+	}
+
+	template<typename ReturnType, typename... Args>
+	const CSignal<ReturnType(Args...)>* CEventBus<ReturnType(Args...)>::Find(const TTopicId topic) const
+	{
+		return const_cast<CEventBus*>(this)->Find(topic);
+	}
+
+	template<typename ReturnType, typename... Args>
+	const bool CEventBus<ReturnType(Args...)>::Publish(const TTopicId topic, Args... args)
+	{
+		TSignal* signal = Find(topic);
+		return signal ? (*signal)(args...) : false;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CEventBus<ReturnType(Args...)>::Clear()
+	{
+		m_topics.clear();
+		m_topicCount = 0;
+	}
+
+	template<typename ReturnType, typename... Args>
+	inline const unsigned CEventBus<ReturnType(Args...)>::Probe(const TTopicId topic) const
+	{
+		const TTopicId id = detail::NonZero(topic);
+		const unsigned mask = m_topics.size() - 1;
+		unsigned index = static_cast<unsigned>(id ^ (id >> 32)) & mask;
+		while (m_topics[index].id != 0 && m_topics[index].id != id)
+		{
+			index = (index + 1) & mask;
+		}
+		return index;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CEventBus<ReturnType(Args...)>::Grow()
+	{
+		std::vector<STopic> topics(m_topics.empty() ? 16 : m_topics.size() * 2);
+		topics.swap(m_topics);
+
+		// Only the pointers to the signals are moved
+		for (STopic& entry : topics)
+		{
+			if (entry.id == 0) continue;
+
+			STopic& newEntry = m_topics[Probe(entry.id)];
+			newEntry.id = entry.id;
+			newEntry.signal = std::move(entry.signal);
+		}
+	}
+}
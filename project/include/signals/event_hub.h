@@ -0,0 +1,180 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_hub.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include "signal.h"
+
+namespace dc
+{
+	namespace detail
+	{
+		inline unsigned& EventTypeCounter()
+		{
+			static unsigned counter = 0;
+			return counter;
+		}
+
+		/*
+		 Dense id of an event type, assigned during the static initialization.
+		 Publishing from another static initializer could see the id before it is assigned.
+		 */
+		template<typename TEvent>
+		struct TEventTypeId
+		{
+			static const unsigned value;
+		};
+
+		template<typename TEvent>
+		const unsigned TEventTypeId<TEvent>::value = EventTypeCounter()++;
+	}
+
+	/*
+	 CEVENTHUB
+
+	 Signals of heterogeneous event types. Every event struct gets its own CSignal<void(const TEvent&)>,
+	 created on first use and indexed by the dense id of its type, so publishing is an array index followed
+	 by a normal emission: no RTTI, no map lookup and no virtual calls.
+	 */
+	class CEventHub
+	{
+		//---------------------------------------------------------------------
+		// Type definitions
+		//---------------------------------------------------------------------
+	public:
+		template<typename TEvent>
+		using TSignal = CSignal<void(const TEvent&)>;
+
+		template<typename TEvent>
+		using TConnection = CConnection<void(const TEvent&)>;
+
+	private:
+		struct SChannel
+		{
+			SChannel() : mp_signal(0), mp_destroy(0) {}
+
+			void*	mp_signal;
+			void	(*mp_destroy)(void*);
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors / Destructors
+		//---------------------------------------------------------------------
+	public:
+		CEventHub() {}
+
+		~CEventHub() { Clear(); }
+
+		CEventHub(CEventHub&& other) noexcept : m_channels(std::move(other.m_channels)) {}
+
+	private:
+		CEventHub(const CEventHub& copy) = delete;
+		CEventHub& operator= (const CEventHub& copy) = delete;
+
+		//---------------------------------------------------------------------
+		// Functions
+		//---------------------------------------------------------------------
+	public:
+		// Returns the signal of the event type, creating it if needed
+		template<typename TEvent>
+		TSignal<TEvent>& Channel();
+
+		// Returns the signal of the event type or null if it was never used
+		template<typename TEvent>
+		TSignal<TEvent>* Find() const;
+
+		template<typename TEvent, typename... TSlot>
+		TConnection<TEvent>& Subscribe(TSlot&&... slot)
+		{
+			return Channel<TEvent>().Connect(std::forward<TSlot>(slot)...);
+		}
+
+		template<typename TEvent, typename... TSlot>
+		void Unsubscribe(TSlot&&... slot)
+		{
+			if (TSignal<TEvent>* signal = Find<TEvent>())
+			{
+				signal->Disconnect(std::forward<TSlot>(slot)...);
+			}
+		}
+
+		// Emits the event. Returns false if nobody ever subscribed to its type.
+		template<typename TEvent>
+		const bool Publish(const TEvent& event) const;
+
+		void Clear();
+
+	private:
+		template<typename TEvent>
+		static void Destroy(void* signal)
+		{
+			delete static_cast<TSignal<TEvent>*>(signal);
+		}
+
+	private:
+		std::vector<SChannel> m_channels;
+	};
+
+	template<typename TEvent>
+	CEventHub::TSignal<TEvent>& CEventHub::Channel()
+	{
+		const unsigned id = detail::TEventTypeId<TEvent>::value;
+		if (id >= m_channels.size())
+		{
+			m_channels.resize(id + 1);
+		}
+
+		SChannel& channel = m_channels[id];
+		if (!channel.mp_signal)
+		{
+			channel.mp_signal = new TSignal<TEvent>();
+			channel.mp_destroy = &CEventHub::Destroy<TEvent>;
+		}
+		return *static_cast<TSignal<TEvent>*>(channel.mp_signal);
+	}
+
+	template<typename TEvent>
+	CEventHub::TSignal<TEvent>* CEventHub::Find() const
+	{
+		const unsigned id = detail::TEventTypeId<TEvent>::value;
+		return id < m_channels.size() ? static_cast<TSignal<TEvent>*>(m_channels[id].mp_signal) : 0;
+	}
+
+	template<typename TEvent>
+	const bool CEventHub::Publish(const TEvent& event) const
+	{
+		TSignal<TEvent>* signal = Find<TEvent>();
+		return signal ? (*signal)(event) : false;
+	}
+
+	inline void CEventHub::Clear()
+	{
+		for (SChannel& channel : m_channels)
+		{
+			if (channel.mp_signal)
+			{
+				channel.mp_destroy(channel.mp_signal);
+			}
+		}
+		m_channels.clear();
+	}
+}
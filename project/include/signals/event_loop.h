@@ -0,0 +1,204 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_loop.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <errno.h>
+#include <atomic>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+#include <system_error>
+
+#include "executor.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	namespace detail
+	{
+		// Emission waiting in a queue with copies of its arguments
+		template<typename TSignal, typename... TValues>
+		class CQueuedEmission
+		{
+		public:
+			CQueuedEmission(TSignal& signal, TValues&&... values) : mp_signal(&signal), m_arguments(std::forward<TValues>(values)...) {}
+
+		public:
+			void operator()() { Emit(typename TMakeIndexSequence<sizeof...(TValues)>::TType()); }
+
+		private:
+			template<unsigned... Indices>
+			void Emit(TIndexSequence<Indices...>) { (*mp_signal)(std::get<Indices>(m_arguments)...); }
+
+		private:
+			TSignal*											mp_signal;
+			std::tuple<typename std::decay<TValues>::type...>	m_arguments;
+		};
+	}
+
+	/*
+	 CEVENTLOOPEXECUTOR
+
+	 Executor for threads sleeping in epoll or poll. Any thread can post tasks or emissions, which wait in a
+	 queue until the loop drains them, and an eventfd becomes readable while there are some. The wakeups are
+	 coalesced: only the first task posted after a drain writes to the eventfd, so a burst of emissions
+	 wakes the loop once and is drained in a single batch. A task posted while a drain takes the queue may
+	 be run by it and still notify the loop, so a wakeup can find nothing to drain.
+
+	 It works with the asynchronous emissions too, dc::EmitAsyncOn(loop, signal, ...) invokes the slots in
+	 the loop.
+	 A task that throws stops the drain: the exception propagates and the tasks after it stay queued for the
+	 next drain, which is notified again. The constructor throws std::system_error if there's no eventfd.
+	 */
+	class CEventLoopExecutor : public CExecutor
+	{
+	public:
+		CEventLoopExecutor();
+
+		~CEventLoopExecutor();
+
+	private:
+		CEventLoopExecutor(const CEventLoopExecutor& copy) = delete;
+		CEventLoopExecutor& operator= (const CEventLoopExecutor& copy) = delete;
+
+	public:
+		// Readable while there are tasks to drain, to add it to the descriptors of the loop
+		const int FileDescriptor() const { return m_eventFd; }
+
+		void Post(TTask&& task) override;
+
+		// Queues the emission of the signal, with copies of the values, to happen when the loop drains it
+		template<typename TSignal, typename... TValues>
+		void Emit(TSignal& signal, TValues&&... values)
+		{
+			Post(detail::CQueuedEmission<TSignal, TValues...>(signal, std::forward<TValues>(values)...));
+		}
+
+		// Runs the tasks posted until now and returns how many. The ones posted meanwhile wake the loop again.
+		const unsigned Drain();
+
+	private:
+		// Clears the tasks drained when the drain ends, even when one throws, queuing again the ones not run
+		struct SDrainedTasks
+		{
+			explicit SDrainedTasks(CEventLoopExecutor* loop) : mp_loop(loop), m_index(0) {}
+			~SDrainedTasks();
+
+			CEventLoopExecutor*	mp_loop;
+			unsigned			m_index;
+		};
+
+		// Makes the eventfd readable unless it was already since the last drain
+		void Notify();
+
+	private:
+		std::mutex			m_mutex;
+		std::vector<TTask>	m_tasks;
+		std::vector<TTask>	m_draining;
+		std::atomic<bool>	m_isNotified;
+		int					m_eventFd;
+	};
+
+	inline CEventLoopExecutor::CEventLoopExecutor() :
+		m_isNotified(false),
+		m_eventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+	{
+		if (m_eventFd < 0)
+		{
+			throw std::system_error(errno, std::system_category(), "The event loop executor couldn't create its eventfd");
+		}
+	}
+
+	inline CEventLoopExecutor::~CEventLoopExecutor()
+	{
+		if (m_eventFd >= 0)
+		{
+			close(m_eventFd);
+		}
+	}
+
+	inline void CEventLoopExecutor::Post(TTask&& task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_tasks.push_back(std::move(task));
+		}
+		Notify();
+	}
+
+	inline void CEventLoopExecutor::Notify()
+	{
+		// The loop is already going to wake up if somebody notified it since the last drain
+		if (!m_isNotified.exchange(true))
+		{
+			const uint64_t one = 1;
+			const ssize_t written = write(m_eventFd, &one, sizeof(one));
+			(void)written;
+		}
+	}
+
+	inline const unsigned CEventLoopExecutor::Drain()
+	{
+		// Clearing the eventfd before the flag, a task posted in between is taken by this drain
+		uint64_t count = 0;
+		const ssize_t result = read(m_eventFd, &count, sizeof(count));
+		(void)result;
+		m_isNotified.store(false);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_draining.swap(m_tasks);
+		}
+
+		// Both vectors keep their capacity, draining doesn't allocate once they are warm
+		SDrainedTasks drained(this);
+		while (drained.m_index < m_draining.size())
+		{
+			m_draining[drained.m_index++]();
+		}
+		return drained.m_index;
+	}
+
+	inline CEventLoopExecutor::SDrainedTasks::~SDrainedTasks()
+	{
+		std::vector<TTask>& draining = mp_loop->m_draining;
+		if (m_index < draining.size())
+		{
+			// A task threw, the ones after it go back in front of the tasks posted meanwhile
+			{
+				std::lock_guard<std::mutex> lock(mp_loop->m_mutex);
+				std::vector<TTask>& tasks = mp_loop->m_tasks;
+				tasks.insert(tasks.begin(), std::make_move_iterator(draining.begin() + m_index), std::make_move_iterator(draining.end()));
+			}
+			mp_loop->Notify();
+		}
+		draining.clear();
+	}
+}
+
+#endif
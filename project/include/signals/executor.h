@@ -0,0 +1,143 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * executor.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace dc
+{
+	/*
+	 CEXECUTOR
+
+	 Runs the tasks posted to it, in any thread and order. Used by the asynchronous emissions.
+	 */
+	class CExecutor
+	{
+	public:
+		using TTask = std::function<void()>;
+
+	public:
+		virtual ~CExecutor() {}
+
+		virtual void Post(TTask&& task) = 0;
+	};
+
+	/*
+	 CTHREADPOOL
+
+	 Executor with a fixed number of threads taking the tasks from a single queue. The destructor runs
+	 the tasks still queued before joining the threads.
+	 */
+	class CThreadPool : public CExecutor
+	{
+	public:
+		// Shared pool used when no executor is given, with a thread per hardware thread
+		static CThreadPool& Default();
+
+	public:
+		const unsigned ThreadCount() const { return m_threads.size(); }
+
+	public:
+		explicit CThreadPool(const unsigned threadCount);
+
+		~CThreadPool();
+
+	private:
+		CThreadPool(const CThreadPool& copy) = delete;
+		CThreadPool& operator= (const CThreadPool& copy) = delete;
+
+	public:
+		void Post(TTask&& task) override;
+
+	private:
+		void Work();
+
+	private:
+		std::mutex					m_mutex;
+		std::condition_variable		m_condition;
+		std::deque<TTask>			m_tasks;
+		std::vector<std::thread>	m_threads;
+		bool						m_isStopping;
+	};
+
+	inline CThreadPool& CThreadPool::Default()
+	{
+		static CThreadPool pool(std::max(2u, std::thread::hardware_concurrency()));
+		return pool;
+	}
+
+	inline CThreadPool::CThreadPool(const unsigned threadCount) :
+		m_isStopping(false)
+	{
+		m_threads.reserve(threadCount);
+		for (unsigned i = 0; i < threadCount; ++i)
+		{
+			m_threads.push_back(std::thread(&CThreadPool::Work, this));
+		}
+	}
+
+	inline CThreadPool::~CThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_condition.notify_all();
+
+		for (std::thread& thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+
+	inline void CThreadPool::Post(TTask&& task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_tasks.push_back(std::move(task));
+		}
+		m_condition.notify_one();
+	}
+
+	inline void CThreadPool::Work()
+	{
+		while (true)
+		{
+			TTask task;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return m_isStopping || !m_tasks.empty(); });
+
+				// Stopping only once the queue is drained
+				if (m_tasks.empty()) return;
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+			task();
+		}
+	}
+}
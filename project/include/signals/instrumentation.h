@@ -0,0 +1,303 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * instrumentation.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+/*
+ Instrumentation of the signals is compiled only when DCPP_SIGNALS_INSTRUMENTATION is defined
+ (CMake option DCPPSIGNALS_INSTRUMENTATION). Otherwise the probes expand to nothing and the
+ registry stays empty.
+ */
+#if defined(DCPP_SIGNALS_INSTRUMENTATION)
+	#define DCPP_SIGNALS_PROBE_EMIT(binding) dc::CEmitProbe emitProbe((binding) ? &(binding)->m_stats : 0)
+	#define DCPP_SIGNALS_PROBE_SLOT(binding) dc::CSlotProbe slotProbe(&(binding)->m_stats)
+	#define DCPP_SIGNALS_PROBE_CONNECTIONS(binding, count) (binding)->m_stats.RecordConnections(count)
+#else
+	#define DCPP_SIGNALS_PROBE_EMIT(binding) ((void)0)
+	#define DCPP_SIGNALS_PROBE_SLOT(binding) ((void)0)
+	#define DCPP_SIGNALS_PROBE_CONNECTIONS(binding, count) ((void)0)
+#endif
+
+namespace dc
+{
+	using TCycles = unsigned long long;
+
+	// Cheapest monotonic counter available, its unit depends on the platform
+	inline TCycles ReadCycleCounter()
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#elif defined(__aarch64__)
+		TCycles value;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+		return value;
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	/*
+	 Plain copy of the statistics of a signal
+	 */
+	struct SSignalStats
+	{
+		const char*		mp_name;
+		const void*		mp_id;
+		TCycles			emitCount;
+		TCycles			slotCallCount;
+		TCycles			slotCycles;
+		TCycles			maxSlotCycles;
+		unsigned		connectionsHighWater;
+	};
+
+	/*
+	 CSIGNALSTATS
+
+	 Statistics of a signal. It registers itself in CSignalStatsRegistry during its lifetime.
+	 Every signal is emitted by one thread at a time, so the counters are updated without read-modify-write
+	 atomics; they are atomic only so the registry can read them from any thread.
+	 */
+	class CSignalStats
+	{
+		friend class CSignalStatsRegistry;
+
+	public:
+		explicit CSignalStats(const void* id);
+
+		~CSignalStats();
+
+	private:
+		CSignalStats(const CSignalStats& copy) = delete;
+		CSignalStats& operator= (const CSignalStats& copy) = delete;
+
+	public:
+		void SetName(const char* name) { mp_name.store(name, std::memory_order_relaxed); }
+
+		void RecordEmit() { Increment(m_emitCount, 1); }
+
+		void RecordSlotCall(const TCycles cycles);
+
+		void RecordConnections(const unsigned count);
+
+		const SSignalStats Snapshot() const;
+
+	private:
+		static void Increment(std::atomic<TCycles>& counter, const TCycles value)
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<const char*>	mp_name;
+		const void*					mp_id;
+
+		std::atomic<TCycles>		m_emitCount;
+		std::atomic<TCycles>		m_slotCallCount;
+		std::atomic<TCycles>		m_slotCycles;
+		std::atomic<TCycles>		m_maxSlotCycles;
+		std::atomic<unsigned>		m_connectionsHighWater;
+
+		// Intrusive list of the registry
+		CSignalStats*				mp_previous;
+		CSignalStats*				mp_next;
+	};
+
+	/*
+	 CSIGNALSTATSREGISTRY
+
+	 Keeps track of the statistics of every living signal, so they can be queried at runtime.
+	 */
+	class CSignalStatsRegistry
+	{
+	public:
+		static CSignalStatsRegistry& Instance()
+		{
+			static CSignalStatsRegistry registry;
+			return registry;
+		}
+
+	public:
+		void Register(CSignalStats* stats);
+
+		void Unregister(CSignalStats* stats);
+
+		const std::vector<SSignalStats> Snapshot() const;
+
+		// The signals that spent more cycles in their slots, sorted from the hottest
+		const std::vector<SSignalStats> Top(const unsigned count) const;
+
+		void Dump(FILE* file, const unsigned count) const;
+
+	private:
+		CSignalStatsRegistry() : mp_head(0) {}
+
+	private:
+		mutable std::mutex	m_mutex;
+		CSignalStats*		mp_head;
+	};
+
+	/*
+	 Probes used by the signals, see the DCPP_SIGNALS_PROBE_* macros
+	 */
+	class CEmitProbe
+	{
+	public:
+		explicit CEmitProbe(CSignalStats* stats)
+		{
+			if (stats) stats->RecordEmit();
+		}
+	};
+
+	class CSlotProbe
+	{
+	public:
+		explicit CSlotProbe(CSignalStats* stats) : mp_stats(stats), m_begin(ReadCycleCounter()) {}
+
+		~CSlotProbe() { mp_stats->RecordSlotCall(ReadCycleCounter() - m_begin); }
+
+	private:
+		CSignalStats*	mp_stats;
+		const TCycles	m_begin;
+	};
+
+	inline CSignalStats::CSignalStats(const void* id) :
+		mp_name(0),
+		mp_id(id),
+		m_emitCount(0),
+		m_slotCallCount(0),
+		m_slotCycles(0),
+		m_maxSlotCycles(0),
+		m_connectionsHighWater(0),
+		mp_previous(0),
+		mp_next(0)
+	{
+		CSignalStatsRegistry::Instance().Register(this);
+	}
+
+	inline CSignalStats::~CSignalStats()
+	{
+		CSignalStatsRegistry::Instance().Unregister(this);
+	}
+
+	inline void CSignalStats::RecordSlotCall(const TCycles cycles)
+	{
+		Increment(m_slotCallCount, 1);
+		Increment(m_slotCycles, cycles);
+		if (cycles > m_maxSlotCycles.load(std::memory_order_relaxed))
+		{
+			m_maxSlotCycles.store(cycles, std::memory_order_relaxed);
+		}
+	}
+
+	inline void CSignalStats::RecordConnections(const unsigned count)
+	{
+		if (count > m_connectionsHighWater.load(std::memory_order_relaxed))
+		{
+			m_connectionsHighWater.store(count, std::memory_order_relaxed);
+		}
+	}
+
+	inline const SSignalStats CSignalStats::Snapshot() const
+	{
+		SSignalStats stats;
+		stats.mp_name = mp_name.load(std::memory_order_relaxed);
+		stats.mp_id = mp_id;
+		stats.emitCount = m_emitCount.load(std::memory_order_relaxed);
+		stats.slotCallCount = m_slotCallCount.load(std::memory_order_relaxed);
+		stats.slotCycles = m_slotCycles.load(std::memory_order_relaxed);
+		stats.maxSlotCycles = m_maxSlotCycles.load(std::memory_order_relaxed);
+		stats.connectionsHighWater = m_connectionsHighWater.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	inline void CSignalStatsRegistry::Register(CSignalStats* stats)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		stats->mp_previous = 0;
+		stats->mp_next = mp_head;
+		if (mp_head) mp_head->mp_previous = stats;
+		mp_head = stats;
+	}
+
+	inline void CSignalStatsRegistry::Unregister(CSignalStats* stats)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (stats->mp_previous) stats->mp_previous->mp_next = stats->mp_next;
+		else mp_head = stats->mp_next;
+
+		if (stats->mp_next) stats->mp_next->mp_previous = stats->mp_previous;
+	}
+
+	inline const std::vector<SSignalStats> CSignalStatsRegistry::Snapshot() const
+	{
+		std::vector<SSignalStats> snapshot;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const CSignalStats* stats = mp_head; stats; stats = stats->mp_next)
+		{
+			snapshot.push_back(stats->Snapshot());
+		}
+		return snapshot;
+	}
+
+	inline const std::vector<SSignalStats> CSignalStatsRegistry::Top(const unsigned count) const
+	{
+		std::vector<SSignalStats> snapshot = Snapshot();
+		const unsigned topCount = std::min<unsigned>(count, snapshot.size());
+
+		std::partial_sort(snapshot.begin(), snapshot.begin() + topCount, snapshot.end(), [](const SSignalStats& first, const SSignalStats& second)
+		{
+			return first.slotCycles > second.slotCycles;
+		});
+		snapshot.resize(topCount);
+		return snapshot;
+	}
+
+	inline void CSignalStatsRegistry::Dump(FILE* file, const unsigned count) const
+	{
+		fprintf(file, "%-32s %12s %12s %14s %12s %12s %6s\n", "Signal", "Emits", "Slot calls", "Slot cycles", "Avg cycles", "Max cycles", "Peak");
+		for (const SSignalStats& stats : Top(count))
+		{
+			const TCycles average = stats.slotCallCount ? stats.slotCycles / stats.slotCallCount : 0;
+			char unnamed[32];
+			if (!stats.mp_name)
+			{
+				snprintf(unnamed, sizeof(unnamed), "%p", stats.mp_id);
+			}
+
+			fprintf(file, "%-32s %12llu %12llu %14llu %12llu %12llu %6u\n", stats.mp_name ? stats.mp_name : unnamed,
+				stats.emitCount, stats.slotCallCount, stats.slotCycles, average, stats.maxSlotCycles, stats.connectionsHighWater);
+		}
+	}
+}
@@ -0,0 +1,71 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * memory_usage.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace dc
+{
+	/*
+	 Memory used by a signal, in bytes
+	 */
+	struct SSignalMemoryUsage
+	{
+		// The signal object itself, wherever it lives
+		std::size_t		signal;
+
+		// Storage of the connections, including the reserved capacity
+		std::size_t		connections;
+
+		// The binding shared with the connections and the profiler
+		std::size_t		binding;
+
+		// Callables owned by the connections
+		std::size_t		callables;
+
+		const std::size_t Heap() const	{ return connections + binding + callables; }
+
+		const std::size_t Total() const	{ return signal + Heap(); }
+	};
+
+	/*
+	 CSIGNALMEMORY
+
+	 Aggregate of the heap memory used by all the living signals. Signals only update it when their
+	 heap usage changes (growing, reserving, shrinking, being destroyed...), not when emitting.
+	 */
+	class CSignalMemory
+	{
+	public:
+		static const std::size_t HeapBytes() { return Counter().load(std::memory_order_relaxed); }
+
+		static void Add(const std::size_t bytes) { Counter().fetch_add(bytes, std::memory_order_relaxed); }
+
+		static void Remove(const std::size_t bytes) { Counter().fetch_sub(bytes, std::memory_order_relaxed); }
+
+	private:
+		static std::atomic<std::size_t>& Counter()
+		{
+			static std::atomic<std::size_t> counter(0);
+			return counter;
+		}
+	};
+}
@@ -0,0 +1,249 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * pipeline.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+namespace dc
+{
+	namespace detail
+	{
+		/*
+		 Stages of a pipeline. Every stage receives the values of the previous one and pushes its output to
+		 the next stage, which is a member, so the whole pipeline is a single object invoked through a
+		 single call. IsDone tells when no value can reach the slot anymore.
+		 */
+		template<typename TPredicate, typename TNext>
+		class CFilterStage
+		{
+		public:
+			CFilterStage(const TPredicate& predicate, TNext&& next) : m_predicate(predicate), m_next(std::move(next)) {}
+
+		public:
+			template<typename... TValues>
+			void operator()(TValues&&... values)
+			{
+				if (m_predicate(values...))
+				{
+					m_next(std::forward<TValues>(values)...);
+				}
+			}
+
+			const bool IsDone() const { return m_next.IsDone(); }
+
+		private:
+			TPredicate	m_predicate;
+			TNext		m_next;
+		};
+
+		template<typename TFunction, typename TNext>
+		class CMapStage
+		{
+		public:
+			CMapStage(const TFunction& function, TNext&& next) : m_function(function), m_next(std::move(next)) {}
+
+		public:
+			template<typename... TValues>
+			void operator()(TValues&&... values) { m_next(m_function(std::forward<TValues>(values)...)); }
+
+			const bool IsDone() const { return m_next.IsDone(); }
+
+		private:
+			TFunction	m_function;
+			TNext		m_next;
+		};
+
+		template<typename TNext>
+		class CTakeStage
+		{
+		public:
+			CTakeStage(const unsigned count, TNext&& next) : m_remaining(count), m_next(std::move(next)) {}
+
+		public:
+			template<typename... TValues>
+			void operator()(TValues&&... values)
+			{
+				if (m_remaining == 0) return;
+
+				--m_remaining;
+				m_next(std::forward<TValues>(values)...);
+			}
+
+			const bool IsDone() const { return m_remaining == 0 || m_next.IsDone(); }
+
+		private:
+			unsigned	m_remaining;
+			TNext		m_next;
+		};
+
+		template<typename TSlot>
+		class CSlotStage
+		{
+		public:
+			explicit CSlotStage(TSlot&& slot) : m_slot(std::move(slot)) {}
+
+		public:
+			template<typename... TValues>
+			void operator()(TValues&&... values) { m_slot(std::forward<TValues>(values)...); }
+
+			const bool IsDone() const { return false; }
+
+		private:
+			TSlot m_slot;
+		};
+
+		// First stage of a connected pipeline, once it's done the emissions skip the operators before a Take
+		template<typename TStages>
+		class CPipelineSlot
+		{
+		public:
+			explicit CPipelineSlot(TStages&& stages) : m_stages(std::move(stages)) {}
+
+		public:
+			template<typename... TValues>
+			void operator()(TValues&&... values)
+			{
+				if (m_stages.IsDone()) return;
+
+				m_stages(std::forward<TValues>(values)...);
+			}
+
+		private:
+			TStages m_stages;
+		};
+
+		// Operators kept by a pipeline until it's connected, they build their stage around the next one
+		template<typename TPredicate>
+		struct SFilter
+		{
+			template<typename TNext>
+			CFilterStage<TPredicate, TNext> Wrap(TNext&& next) const { return CFilterStage<TPredicate, TNext>(m_predicate, std::move(next)); }
+
+			TPredicate m_predicate;
+		};
+
+		template<typename TFunction>
+		struct SMap
+		{
+			template<typename TNext>
+			CMapStage<TFunction, TNext> Wrap(TNext&& next) const { return CMapStage<TFunction, TNext>(m_function, std::move(next)); }
+
+			TFunction m_function;
+		};
+
+		struct STake
+		{
+			template<typename TNext>
+			CTakeStage<TNext> Wrap(TNext&& next) const { return CTakeStage<TNext>(m_count, std::move(next)); }
+
+			unsigned m_count;
+		};
+
+		// Wraps the stages from the last operator to the first one
+		template<unsigned Index, typename TNext, typename... TOperators>
+		struct SPipelineBuilder
+		{
+			using TOperator = typename std::tuple_element<Index - 1, std::tuple<TOperators...>>::type;
+			using TStage = decltype(std::declval<const TOperator&>().Wrap(std::declval<TNext>()));
+			using TPrevious = SPipelineBuilder<Index - 1, TStage, TOperators...>;
+			using TType = typename TPrevious::TType;
+
+			static TType Build(const std::tuple<TOperators...>& operators, TNext&& next)
+			{
+				return TPrevious::Build(operators, std::get<Index - 1>(operators).Wrap(std::move(next)));
+			}
+		};
+
+		template<typename TNext, typename... TOperators>
+		struct SPipelineBuilder<0, TNext, TOperators...>
+		{
+			using TType = TNext;
+
+			static TType Build(const std::tuple<TOperators...>& operators, TNext&& next) { return std::move(next); }
+		};
+	}
+
+	/*
+	 CPIPELINE
+
+	 Chain of operators applied to the emissions of a signal before reaching a slot:
+
+		signal.Filter(isPressed).Map(toCommand).Take(1).Connect(execute);
+
+	 Connecting fuses the operators and the slot into a single owned callable, there are no intermediate
+	 signals nor connections, so an emission costs one indirect call whatever the number of operators.
+	 Map passes a single value to the next operator. The predicates, functions and slot are copied.
+	 Once Take let its values pass, the emissions return without running any operator. The connection
+	 stays until it's disconnected.
+	 */
+	template<typename TSignal, typename... TOperators>
+	class CPipeline
+	{
+	public:
+		using TConnection = typename TSignal::TConnection;
+
+	public:
+		CPipeline(TSignal& signal, const std::tuple<TOperators...>& operators) : mp_signal(&signal), m_operators(operators) {}
+
+	public:
+		template<typename TPredicate>
+		CPipeline<TSignal, TOperators..., detail::SFilter<typename std::decay<TPredicate>::type>> Filter(TPredicate&& predicate) const
+		{
+			return Then(detail::SFilter<typename std::decay<TPredicate>::type>{ std::forward<TPredicate>(predicate) });
+		}
+
+		template<typename TFunction>
+		CPipeline<TSignal, TOperators..., detail::SMap<typename std::decay<TFunction>::type>> Map(TFunction&& function) const
+		{
+			return Then(detail::SMap<typename std::decay<TFunction>::type>{ std::forward<TFunction>(function) });
+		}
+
+		// Only the first count values pass
+		CPipeline<TSignal, TOperators..., detail::STake> Take(const unsigned count) const
+		{
+			return Then(detail::STake{ count });
+		}
+
+		template<typename TSlot>
+		TConnection& Connect(TSlot&& slot) const
+		{
+			using TSlotType = typename std::decay<TSlot>::type;
+			using TSlotStage = detail::CSlotStage<TSlotType>;
+			using TBuilder = detail::SPipelineBuilder<sizeof...(TOperators), TSlotStage, TOperators...>;
+			using TPipelineSlot = detail::CPipelineSlot<typename TBuilder::TType>;
+
+			TSlotStage slotStage(TSlotType(std::forward<TSlot>(slot)));
+			return mp_signal->ConnectOwned(TPipelineSlot(TBuilder::Build(m_operators, std::move(slotStage))));
+		}
+
+	private:
+		template<typename TOperator>
+		CPipeline<TSignal, TOperators..., TOperator> Then(const TOperator& nextOperator) const
+		{
+			return CPipeline<TSignal, TOperators..., TOperator>(*mp_signal, std::tuple_cat(m_operators, std::make_tuple(nextOperator)));
+		}
+
+	private:
+		TSignal*					mp_signal;
+		std::tuple<TOperators...>	m_operators;
+	};
+}
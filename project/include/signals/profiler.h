@@ -0,0 +1,299 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * profiler.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <stdio.h>
+
+#include "instrumentation.h"
+
+namespace dc
+{
+	/*
+	 Plain copy of the latencies sampled for one slot
+	 */
+	struct SSlotProfile
+	{
+		static const unsigned kBucketCount = 32;
+
+		// Object and code bound to the slot: the caller and the member function, the functor and its
+		// invoker, or no object and the free function
+		const void*		mp_object;
+		const void*		mp_function;
+
+		TCycles			callCount;
+		TCycles			totalCycles;
+		TCycles			maxCycles;
+
+		// histogram[i] counts the calls that took [2^i, 2^(i+1)) cycles
+		unsigned		histogram[kBucketCount];
+	};
+
+	/*
+	 CSLOTPROFILER
+
+	 Sampling profiler of the slots of a signal. Only one emission out of every 'sampleRate' is timed, so it
+	 can be left enabled in production builds. The latencies are kept per slot in lock-free counters; slots
+	 whose slowest sampled call exceeds the threshold are reported as slow.
+	 The number of slots tracked is fixed, the samples of extra slots are dropped.
+	 */
+	class CSlotProfiler
+	{
+	public:
+		static const unsigned kMaxSlots = 64;
+
+	private:
+		enum EEntryState
+		{
+			EMPTY,
+			CLAIMED,
+			READY
+		};
+
+		struct SEntry
+		{
+			std::atomic<unsigned>		state;
+			const void*					mp_object;
+			const void*					mp_function;
+
+			std::atomic<TCycles>		callCount;
+			std::atomic<TCycles>		totalCycles;
+			std::atomic<TCycles>		maxCycles;
+			std::atomic<unsigned>		histogram[SSlotProfile::kBucketCount];
+		};
+
+		//---------------------------------------------------------------------
+		// Getters / Setters
+		//---------------------------------------------------------------------
+	public:
+		const unsigned	SampleRate() const	{ return m_sampleRate; }
+
+		const TCycles	Threshold() const	{ return m_threshold; }
+
+		//---------------------------------------------------------------------
+		// Constructors / Destructors
+		//---------------------------------------------------------------------
+	public:
+		CSlotProfiler(const unsigned sampleRate, const TCycles threshold);
+
+	private:
+		CSlotProfiler(const CSlotProfiler& copy) = delete;
+		CSlotProfiler& operator= (const CSlotProfiler& copy) = delete;
+
+		//---------------------------------------------------------------------
+		// Functions
+		//---------------------------------------------------------------------
+	public:
+		// Tells if the current emission has to be timed
+		const bool Sample();
+
+		void Record(const void* object, const void* function, const TCycles cycles);
+
+		const std::vector<SSlotProfile> Profiles() const;
+
+		// Profiles of the slots whose slowest sampled call took more cycles than the threshold
+		const std::vector<SSlotProfile> SlowSlots() const;
+
+		void Report(FILE* file, const char* signalName) const;
+
+	private:
+		SEntry* Find(const void* object, const void* function);
+
+		static const SSlotProfile Snapshot(const SEntry& entry);
+
+		static const unsigned Bucket(TCycles cycles);
+
+	private:
+		const unsigned			m_sampleRate;
+		const TCycles			m_threshold;
+		std::atomic<unsigned>	m_countdown;
+
+		SEntry					m_entries[kMaxSlots];
+	};
+
+	/*
+	 Times the call to a slot when the emission is sampled (profiler not null)
+	 */
+	class CSlotSample
+	{
+	public:
+		template<typename TConnection>
+		CSlotSample(CSlotProfiler* profiler, const TConnection& connection) :
+			mp_profiler(profiler),
+			mp_object(0),
+			mp_function(0),
+			m_begin(0)
+		{
+			if (!profiler) return;
+
+			mp_object = connection.ObjectAddress();
+			mp_function = connection.FunctionAddress();
+			m_begin = ReadCycleCounter();
+		}
+
+		~CSlotSample()
+		{
+			if (mp_profiler)
+			{
+				mp_profiler->Record(mp_object, mp_function, ReadCycleCounter() - m_begin);
+			}
+		}
+
+	private:
+		CSlotProfiler*	mp_profiler;
+		const void*		mp_object;
+		const void*		mp_function;
+		TCycles			m_begin;
+	};
+
+	inline CSlotProfiler::CSlotProfiler(const unsigned sampleRate, const TCycles threshold) :
+		m_sampleRate(sampleRate ? sampleRate : 1),
+		m_threshold(threshold),
+		m_countdown(1)
+	{
+		for (SEntry& entry : m_entries)
+		{
+			entry.state.store(EMPTY, std::memory_order_relaxed);
+			entry.mp_object = 0;
+			entry.mp_function = 0;
+			entry.callCount.store(0, std::memory_order_relaxed);
+			entry.totalCycles.store(0, std::memory_order_relaxed);
+			entry.maxCycles.store(0, std::memory_order_relaxed);
+			for (std::atomic<unsigned>& bucket : entry.histogram)
+			{
+				bucket.store(0, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	inline const bool CSlotProfiler::Sample()
+	{
+		if (m_countdown.fetch_sub(1, std::memory_order_relaxed) != 1) return false;
+
+		m_countdown.store(m_sampleRate, std::memory_order_relaxed);
+		return true;
+	}
+
+	inline void CSlotProfiler::Record(const void* object, const void* function, const TCycles cycles)
+	{
+		SEntry* entry = Find(object, function);
+		if (!entry) return;
+
+		entry->callCount.fetch_add(1, std::memory_order_relaxed);
+		entry->totalCycles.fetch_add(cycles, std::memory_order_relaxed);
+		entry->histogram[Bucket(cycles)].fetch_add(1, std::memory_order_relaxed);
+
+		TCycles maxCycles = entry->maxCycles.load(std::memory_order_relaxed);
+		while (cycles > maxCycles && !entry->maxCycles.compare_exchange_weak(maxCycles, cycles, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	inline const std::vector<SSlotProfile> CSlotProfiler::Profiles() const
+	{
+		std::vector<SSlotProfile> profiles;
+		for (const SEntry& entry : m_entries)
+		{
+			if (entry.state.load(std::memory_order_acquire) == READY)
+			{
+				profiles.push_back(Snapshot(entry));
+			}
+		}
+		return profiles;
+	}
+
+	inline const std::vector<SSlotProfile> CSlotProfiler::SlowSlots() const
+	{
+		std::vector<SSlotProfile> slowSlots;
+		for (const SSlotProfile& profile : Profiles())
+		{
+			if (profile.maxCycles > m_threshold)
+			{
+				slowSlots.push_back(profile);
+			}
+		}
+		return slowSlots;
+	}
+
+	inline void CSlotProfiler::Report(FILE* file, const char* signalName) const
+	{
+		for (const SSlotProfile& profile : SlowSlots())
+		{
+			const TCycles average = profile.callCount ? profile.totalCycles / profile.callCount : 0;
+			fprintf(file, "[%s] slow slot: object %p function %p, %llu sampled calls, avg %llu, max %llu cycles\n",
+				signalName ? signalName : "unnamed", profile.mp_object, profile.mp_function,
+				profile.callCount, average, profile.maxCycles);
+		}
+	}
+
+	inline CSlotProfiler::SEntry* CSlotProfiler::Find(const void* object, const void* function)
+	{
+		const std::size_t hash = reinterpret_cast<std::size_t>(object) * 31 ^ reinterpret_cast<std::size_t>(function);
+		unsigned index = static_cast<unsigned>(hash ^ (hash >> 16)) % kMaxSlots;
+
+		for (unsigned probes = 0; probes < kMaxSlots; ++probes, index = (index + 1) % kMaxSlots)
+		{
+			SEntry& entry = m_entries[index];
+			unsigned state = entry.state.load(std::memory_order_acquire);
+
+			if (state == EMPTY && entry.state.compare_exchange_strong(state, CLAIMED, std::memory_order_acquire))
+			{
+				entry.mp_object = object;
+				entry.mp_function = function;
+				entry.state.store(READY, std::memory_order_release);
+				return &entry;
+			}
+
+			// Another thread is claiming it, we can't know yet if it is our slot
+			if (state == CLAIMED) return 0;
+
+			if (entry.mp_object == object && entry.mp_function == function) return &entry;
+		}
+		return 0;
+	}
+
+	inline const SSlotProfile CSlotProfiler::Snapshot(const SEntry& entry)
+	{
+		SSlotProfile profile;
+		profile.mp_object = entry.mp_object;
+		profile.mp_function = entry.mp_function;
+		profile.callCount = entry.callCount.load(std::memory_order_relaxed);
+		profile.totalCycles = entry.totalCycles.load(std::memory_order_relaxed);
+		profile.maxCycles = entry.maxCycles.load(std::memory_order_relaxed);
+		for (unsigned i = 0; i < SSlotProfile::kBucketCount; ++i)
+		{
+			profile.histogram[i] = entry.histogram[i].load(std::memory_order_relaxed);
+		}
+		return profile;
+	}
+
+	inline const unsigned CSlotProfiler::Bucket(TCycles cycles)
+	{
+		unsigned bucket = 0;
+		while (cycles > 1 && bucket < SSlotProfile::kBucketCount - 1)
+		{
+			cycles >>= 1;
+			++bucket;
+		}
+		return bucket;
+	}
+}
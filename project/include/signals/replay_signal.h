@@ -0,0 +1,180 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * replay_signal.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "signal.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	template<typename TSignature, unsigned HistorySize = 1>
+	class CReplaySignal;
+
+	/*
+	 CREPLAYSIGNAL
+
+	 Signal that remembers the arguments of its last emissions and replays them, oldest first, to every slot
+	 connected later, so components connecting after an event like "configuration loaded" don't miss it.
+	 With the default history of one emission it behaves like a behavior subject.
+	 The arguments are copied in a fixed ring, once it's full every emission overwrites the oldest entry
+	 without allocating, unless the arguments themselves allocate when assigned.
+	 */
+	template<unsigned HistorySize, typename ReturnType, typename... Args>
+	class CReplaySignal<ReturnType(Args...), HistorySize>
+	{
+		static_assert(HistorySize > 0, "The history must keep at least one emission");
+		static_assert(detail::TAreCopyable<Args...>::value, "The arguments must be copyable to replay them");
+
+		//---------------------------------------------------------------------
+		// Type definitions
+		//---------------------------------------------------------------------
+	public:
+		using TSignal = CSignal<ReturnType(Args...)>;
+		using TConnection = typename TSignal::TConnection;
+
+	private:
+		using TArguments = std::tuple<typename std::decay<Args>::type...>;
+		using TIndices = typename detail::TMakeIndexSequence<sizeof...(Args)>::TType;
+		using TStorage = typename std::aligned_storage<sizeof(TArguments), alignof(TArguments)>::type;
+
+		//---------------------------------------------------------------------
+		// Constructors / Destructors
+		//---------------------------------------------------------------------
+	public:
+		CReplaySignal() : m_first(0), m_count(0) {}
+
+		~CReplaySignal() { ClearHistory(); }
+
+	private:
+		CReplaySignal(const CReplaySignal& copy) = delete;
+		CReplaySignal& operator= (const CReplaySignal& copy) = delete;
+
+		//---------------------------------------------------------------------
+		// Functions
+		//---------------------------------------------------------------------
+	public:
+		// Same overloads than CSignal::Connect, the new slot receives the history before returning
+		template<typename... TSlot>
+		TConnection& Connect(TSlot&&... slot)
+		{
+			return Replay(m_signal.Connect(std::forward<TSlot>(slot)...));
+		}
+
+		template<typename T>
+		TConnection& ConnectOwned(T&& callable)
+		{
+			return Replay(m_signal.ConnectOwned(std::forward<T>(callable)));
+		}
+
+		template<typename... TSlot>
+		TConnection& ConnectObserver(TSlot&&... slot)
+		{
+			return Replay(m_signal.ConnectObserver(std::forward<TSlot>(slot)...));
+		}
+
+		template<typename... TSlot>
+		void Disconnect(TSlot&&... slot)
+		{
+			m_signal.Disconnect(std::forward<TSlot>(slot)...);
+		}
+
+		// Records the arguments and emits them. Returns false if there weren't slots, the arguments are recorded anyway.
+		const bool operator() (Args... args);
+
+		// Forgets the emissions, the slots connected from now on won't receive anything
+		void ClearHistory();
+
+		// Emissions that will be replayed to the next slot
+		const unsigned HistoryCount() const { return m_count; }
+
+		const unsigned Count() const { return m_signal.Count(); }
+
+		TSignal& Signal() { return m_signal; }
+
+	private:
+		void Record(const typename std::decay<Args>::type&... args);
+
+		TConnection& Replay(TConnection& connection);
+
+		template<unsigned... Indices>
+		static void Invoke(const TConnection& connection, const TArguments& arguments, detail::TIndexSequence<Indices...>)
+		{
+			connection(std::get<Indices>(arguments)...);
+		}
+
+		TArguments& Entry(const unsigned index) { return *reinterpret_cast<TArguments*>(&m_history[index % HistorySize]); }
+
+	private:
+		TSignal		m_signal;
+		TStorage	m_history[HistorySize];
+		unsigned	m_first;
+		unsigned	m_count;
+	};
+
+	template<unsigned HistorySize, typename ReturnType, typename... Args>
+	const bool CReplaySignal<ReturnType(Args...), HistorySize>::operator() (Args... args)
+	{
+		const bool hasSlots = !m_signal.IsEmpty();
+		Record(args...);
+		m_signal(std::forward<Args>(args)...);
+		return hasSlots;
+	}
+
+	template<unsigned HistorySize, typename ReturnType, typename... Args>
+	void CReplaySignal<ReturnType(Args...), HistorySize>::ClearHistory()
+	{
+		for (unsigned i = 0; i < m_count; ++i)
+		{
+			Entry(m_first + i).~TArguments();
+		}
+		m_first = 0;
+		m_count = 0;
+	}
+
+	template<unsigned HistorySize, typename ReturnType, typename... Args>
+	void CReplaySignal<ReturnType(Args...), HistorySize>::Record(const typename std::decay<Args>::type&... args)
+	{
+		// Building the entries while the ring warms up, reusing the oldest one later
+		if (m_count < HistorySize)
+		{
+			new (&Entry(m_first + m_count)) TArguments(args...);
+			++m_count;
+			return;
+		}
+
+		Entry(m_first) = std::tie(args...);
+		m_first = (m_first + 1) % HistorySize;
+	}
+
+	template<unsigned HistorySize, typename ReturnType, typename... Args>
+	typename CReplaySignal<ReturnType(Args...), HistorySize>::TConnection& CReplaySignal<ReturnType(Args...), HistorySize>::Replay(TConnection& connection)
+	{
+		for (unsigned i = 0; i < m_count; ++i)
+		{
+			Invoke(connection, Entry(m_first + i), TIndices());
+		}
+		return connection;
+	}
+}
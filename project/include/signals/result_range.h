@@ -0,0 +1,181 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * result_range.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <iterator>
+#include <type_traits>
+
+#include "connection.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	template<typename TSignal>
+	class CResultRange;
+
+	/*
+	 CRESULTRANGE
+
+	 Input range over the values returned by the slots of a signal. A slot is only invoked when its position
+	 is dereferenced, so a caller looking for the first acceptable value stops invoking slots as soon as it
+	 finds it. Only the current value is kept, there is no buffer of results.
+
+	 The range keeps a copy of the arguments and must outlive its iterators. One-shot connections are
+	 consumed when invoked and removed by the next non-const operation of the signal, like in const emissions.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CResultRange<CSignal<ReturnType(Args...)>>
+	{
+		static_assert(!std::is_void<ReturnType>::value, "There are no results to iterate for signals returning void");
+
+	public:
+		using TSignal		= CSignal<ReturnType(Args...)>;
+		using TValue		= typename std::decay<ReturnType>::type;
+		using TArguments	= std::tuple<typename std::decay<Args>::type...>;
+
+		class CIterator
+		{
+		public:
+			using iterator_category	= std::input_iterator_tag;
+			using value_type		= TValue;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= const TValue*;
+			using reference			= const TValue&;
+
+		public:
+			CIterator(CResultRange* range, const unsigned index) : mp_range(range), m_index(index) {}
+
+		public:
+			const TValue& operator*() const { return mp_range->Value(m_index); }
+
+			const TValue* operator->() const { return &mp_range->Value(m_index); }
+
+			CIterator& operator++() { m_index = mp_range->Next(m_index + 1); return *this; }
+
+			void operator++(int) { ++*this; }
+
+			const bool operator== (const CIterator& other) const;
+
+			const bool operator!= (const CIterator& other) const { return !(*this == other); }
+
+		private:
+			const bool IsEnd() const { return m_index >= mp_range->Size(); }
+
+		private:
+			CResultRange*	mp_range;
+			unsigned		m_index;
+		};
+
+	public:
+		template<typename... TArgs>
+		explicit CResultRange(const TSignal& signal, TArgs&&... args);
+
+		~CResultRange() { Reset(); }
+
+		CResultRange(CResultRange&& moved);
+
+	private:
+		CResultRange(const CResultRange& copy) = delete;
+		CResultRange& operator= (const CResultRange& copy) = delete;
+
+	public:
+		CIterator begin() { return CIterator(this, Next(0)); }
+
+		CIterator end() { return CIterator(this, Size()); }
+
+	private:
+		const unsigned Size() const { return mp_signal->m_connections.size(); }
+
+		const unsigned Next(const unsigned index) const { return mp_signal->NextPending(index); }
+
+		// Invokes the slot at index the first time its value is asked
+		const TValue& Value(const unsigned index);
+
+		void Reset();
+
+	private:
+		const TSignal*	mp_signal;
+		TArguments		m_arguments;
+
+		// The current value, built in place because it may not be default constructible
+		typename std::aligned_storage<sizeof(TValue), alignof(TValue)>::type m_value;
+		unsigned		m_valueIndex;
+		bool			m_hasValue;
+	};
+
+	template<typename ReturnType, typename... Args>
+	const bool CResultRange<CSignal<ReturnType(Args...)>>::CIterator::operator== (const CIterator& other) const
+	{
+		// Slots connected or disconnected while iterating move the end
+		const bool isEnd = IsEnd();
+		const bool isOtherEnd = other.IsEnd();
+		if (isEnd || isOtherEnd) return isEnd == isOtherEnd;
+
+		return m_index == other.m_index;
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename... TArgs>
+	CResultRange<CSignal<ReturnType(Args...)>>::CResultRange(const TSignal& signal, TArgs&&... args) :
+		mp_signal(&signal),
+		m_arguments(std::forward<TArgs>(args)...),
+		m_valueIndex(0),
+		m_hasValue(false)
+	{}
+
+	template<typename ReturnType, typename... Args>
+	CResultRange<CSignal<ReturnType(Args...)>>::CResultRange(CResultRange&& moved) :
+		mp_signal(moved.mp_signal),
+		m_arguments(std::move(moved.m_arguments)),
+		m_valueIndex(0),
+		m_hasValue(false)
+	{}
+
+	template<typename ReturnType, typename... Args>
+	const typename CResultRange<CSignal<ReturnType(Args...)>>::TValue& CResultRange<CSignal<ReturnType(Args...)>>::Value(const unsigned index)
+	{
+		TValue* value = reinterpret_cast<TValue*>(&m_value);
+		if (m_hasValue && m_valueIndex == index) return *value;
+
+		Reset();
+
+		using TIndices = typename detail::TMakeIndexSequence<sizeof...(Args)>::TType;
+		const auto& connection = mp_signal->m_connections[index];
+		mp_signal->Acquire(connection);
+
+		DCPP_SIGNALS_PROBE_SLOT(mp_signal->mp_binding);
+		DCPP_SIGNALS_TRACE_SLOT(connection);
+		new (value) TValue(TSignal::Invoke(connection, m_arguments, TIndices()));
+		m_valueIndex = index;
+		m_hasValue = true;
+		return *value;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CResultRange<CSignal<ReturnType(Args...)>>::Reset()
+	{
+		if (!m_hasValue) return;
+
+		reinterpret_cast<TValue*>(&m_value)->~TValue();
+		m_hasValue = false;
+	}
+}
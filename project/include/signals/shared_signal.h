@@ -0,0 +1,456 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * shared_signal.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "signal.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	namespace detail
+	{
+		// Beginning of the shared memory segments, followed by the slots of the ring
+		struct SSharedRingHeader
+		{
+			uint32_t				m_magic;
+			uint32_t				m_payloadSize;
+			uint32_t				m_capacity;
+			std::atomic<uint32_t>	m_subscriberCount;
+
+			// Written by the publisher on every emission, apart from the rest to not share their cache line
+			alignas(64) std::atomic<uint64_t>	m_head;
+			alignas(64) std::atomic<uint32_t>	m_wakeups;
+			std::atomic<uint32_t>				m_sleepers;
+		};
+
+		static const uint32_t kSharedRingMagic = 0x44435352;
+
+		template<typename... Types>
+		struct TArePayload : std::true_type {};
+
+		template<typename Type, typename... Types>
+		struct TArePayload<Type, Types...> :
+			std::integral_constant<bool, std::is_trivially_copyable<Type>::value && TArePayload<Types...>::value> {};
+
+		// Upper bound of the size of the payload of the arguments, whatever their padding
+		template<typename... Types>
+		struct TPayloadBound : std::integral_constant<std::size_t, 1> {};
+
+		template<typename Type, typename... Types>
+		struct TPayloadBound<Type, Types...> :
+			std::integral_constant<std::size_t, sizeof(Type) + alignof(Type) + TPayloadBound<Types...>::value> {};
+
+		// Places every argument at an offset aligned for its type and returns the size of the payload
+		template<typename... Types>
+		inline const std::size_t PayloadLayout(std::size_t* offsets)
+		{
+			const std::size_t sizes[] = { 0, sizeof(Types)... };
+			const std::size_t alignments[] = { 1, alignof(Types)... };
+
+			std::size_t size = 0;
+			for (unsigned i = 1; i <= sizeof...(Types); ++i)
+			{
+				size = (size + alignments[i] - 1) & ~(alignments[i] - 1);
+				offsets[i - 1] = size;
+				size += sizes[i];
+			}
+			return size;
+		}
+
+		inline const std::size_t SharedSlotStride(const std::size_t payloadSize)
+		{
+			return (sizeof(std::atomic<uint64_t>) + payloadSize + 7) & ~std::size_t(7);
+		}
+
+		inline std::atomic<uint64_t>& SharedSlotSequence(char* slot) { return *reinterpret_cast<std::atomic<uint64_t>*>(slot); }
+
+		inline void FutexWait(std::atomic<uint32_t>& word, const uint32_t expected, const timespec* timeout)
+		{
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, timeout, 0, 0);
+		}
+
+		inline void FutexWakeAll(std::atomic<uint32_t>& word)
+		{
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, 0, 0, 0);
+		}
+	}
+
+	template<typename TSignature>
+	class CSharedSignalPublisher;
+
+	/*
+	 CSHAREDSIGNALPUBLISHER
+
+	 Emits into a ring in a POSIX shared memory segment that the subscribers of other processes, or of the same
+	 one, dispatch to their own signals. The arguments must be trivially copyable and are copied as they are,
+	 there is no serialization, so all the processes must be built with the same types.
+
+	 There's a single publisher per segment and it never waits: the subscribers that fall behind more than the
+	 capacity of the ring lose the oldest emissions. Every slot has a sequence number, odd while it's written,
+	 so the subscribers detect the slots overwritten while they read them. The sleeping subscribers are woken
+	 with a futex on the segment, only when there are some.
+	 The segment is created by the publisher and removed when it's destroyed. The publisher isn't opened when
+	 a segment with its name already exists, the one of a publisher that's alive or that crashed, which can be
+	 removed with RemoveSharedSignal.
+	 */
+	template<typename... Args>
+	class CSharedSignalPublisher<void(Args...)>
+	{
+		static_assert(detail::TArePayload<typename std::decay<Args>::type...>::value, "The arguments of shared signals must be trivially copyable");
+
+	public:
+		CSharedSignalPublisher(const char* name, const unsigned capacity = 1024);
+
+		~CSharedSignalPublisher();
+
+	private:
+		CSharedSignalPublisher(const CSharedSignalPublisher& copy) = delete;
+		CSharedSignalPublisher& operator= (const CSharedSignalPublisher& copy) = delete;
+
+	public:
+		const bool IsOpen() const { return mp_header != 0; }
+
+		const unsigned SubscriberCount() const { return IsOpen() ? mp_header->m_subscriberCount.load(std::memory_order_relaxed) : 0; }
+
+		// Copies the arguments in the next slot and wakes the subscribers waiting
+		void operator() (Args... args);
+
+	private:
+		detail::SSharedRingHeader*	mp_header;
+		char*						mp_slots;
+		std::size_t					m_segmentSize;
+		std::size_t					m_stride;
+		std::size_t					m_offsets[sizeof...(Args) + 1];
+		uint64_t					m_head;
+		std::string					m_name;
+	};
+
+	// Removes the segment of a publisher, left behind by one that crashed. Returns false if there wasn't one
+	inline const bool RemoveSharedSignal(const char* name) { return shm_unlink(name) == 0; }
+
+	template<typename TSignature>
+	class CSharedSignalSubscriber;
+
+	/*
+	 CSHAREDSIGNALSUBSCRIBER
+
+	 Reads the emissions of a publisher, from the moment it subscribes, and emits them in its own signal from
+	 the thread calling Dispatch or Wait. Every subscriber reads at its own pace.
+	 */
+	template<typename... Args>
+	class CSharedSignalSubscriber<void(Args...)>
+	{
+		static_assert(detail::TArePayload<typename std::decay<Args>::type...>::value, "The arguments of shared signals must be trivially copyable");
+
+	public:
+		using TSignal = CSignal<void(Args...)>;
+		using TConnection = typename TSignal::TConnection;
+
+	private:
+		using TIndices = typename detail::TMakeIndexSequence<sizeof...(Args)>::TType;
+		using TPayload = typename std::aligned_storage<detail::TPayloadBound<typename std::decay<Args>::type...>::value, alignof(std::max_align_t)>::type;
+
+	public:
+		explicit CSharedSignalSubscriber(const char* name);
+
+		~CSharedSignalSubscriber();
+
+	private:
+		CSharedSignalSubscriber(const CSharedSignalSubscriber& copy) = delete;
+		CSharedSignalSubscriber& operator= (const CSharedSignalSubscriber& copy) = delete;
+
+	public:
+		const bool IsOpen() const { return mp_header != 0; }
+
+		template<typename... TSlot>
+		TConnection& Connect(TSlot&&... slot) { return m_signal.Connect(std::forward<TSlot>(slot)...); }
+
+		template<typename T>
+		TConnection& ConnectOwned(T&& callable) { return m_signal.ConnectOwned(std::forward<T>(callable)); }
+
+		template<typename... TSlot>
+		void Disconnect(TSlot&&... slot) { m_signal.Disconnect(std::forward<TSlot>(slot)...); }
+
+		TSignal& Signal() { return m_signal; }
+
+		// Emits the emissions published since the last call, without waiting. Returns how many.
+		const unsigned Dispatch();
+
+		// Sleeps until there is something to dispatch or the timeout expires, then dispatches it
+		const unsigned Wait(const std::chrono::nanoseconds timeout);
+
+		// Emissions overwritten before being read
+		const uint64_t LostCount() const { return m_lostCount; }
+
+	private:
+		const bool HasPending() const { return mp_header->m_head.load(std::memory_order_acquire) != m_cursor; }
+
+		// Copies the emission at the cursor, false if it was overwritten
+		const bool Read(TPayload& payload);
+
+		template<unsigned... Indices>
+		void Emit(TPayload& payload, detail::TIndexSequence<Indices...>)
+		{
+			using TArguments = std::tuple<typename std::decay<Args>::type...>;
+			char* bytes = reinterpret_cast<char*>(&payload);
+			m_signal(*reinterpret_cast<typename std::tuple_element<Indices, TArguments>::type*>(bytes + m_offsets[Indices])...);
+		}
+
+	private:
+		TSignal						m_signal;
+		detail::SSharedRingHeader*	mp_header;
+		char*						mp_slots;
+		std::size_t					m_segmentSize;
+		std::size_t					m_stride;
+		std::size_t					m_offsets[sizeof...(Args) + 1];
+		uint64_t					m_cursor;
+		uint64_t					m_lostCount;
+	};
+
+	template<typename... Args>
+	CSharedSignalPublisher<void(Args...)>::CSharedSignalPublisher(const char* name, const unsigned capacity) :
+		mp_header(0),
+		mp_slots(0),
+		m_segmentSize(0),
+		m_stride(0),
+		m_head(0),
+		m_name(name)
+	{
+		unsigned slotCount = 1;
+		while (slotCount < capacity) slotCount <<= 1;
+
+		const std::size_t payloadSize = detail::PayloadLayout<typename std::decay<Args>::type...>(m_offsets);
+		m_stride = detail::SharedSlotStride(payloadSize);
+		m_segmentSize = sizeof(detail::SSharedRingHeader) + slotCount * m_stride;
+
+		const int file = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (file < 0) return;
+
+		void* mapping = MAP_FAILED;
+		if (ftruncate(file, m_segmentSize) == 0)
+		{
+			mapping = mmap(0, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		}
+		close(file);
+
+		if (mapping == MAP_FAILED)
+		{
+			shm_unlink(name);
+			return;
+		}
+
+		// The segment comes zeroed, every slot has sequence 0 which is never a valid one
+		detail::SSharedRingHeader* header = new (mapping) detail::SSharedRingHeader();
+		header->m_payloadSize = payloadSize;
+		header->m_capacity = slotCount;
+		header->m_subscriberCount.store(0, std::memory_order_relaxed);
+		header->m_head.store(0, std::memory_order_relaxed);
+		header->m_wakeups.store(0, std::memory_order_relaxed);
+		header->m_sleepers.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		header->m_magic = detail::kSharedRingMagic;
+
+		mp_header = header;
+		mp_slots = static_cast<char*>(mapping) + sizeof(detail::SSharedRingHeader);
+	}
+
+	template<typename... Args>
+	CSharedSignalPublisher<void(Args...)>::~CSharedSignalPublisher()
+	{
+		if (!mp_header) return;
+
+		munmap(mp_header, m_segmentSize);
+		shm_unlink(m_name.c_str());
+	}
+
+	template<typename... Args>
+	void CSharedSignalPublisher<void(Args...)>::operator() (Args... args)
+	{
+		if (!mp_header) return;
+
+		char* slot = mp_slots + (m_head & (mp_header->m_capacity - 1)) * m_stride;
+		std::atomic<uint64_t>& sequence = detail::SharedSlotSequence(slot);
+		char* payload = slot + sizeof(std::atomic<uint64_t>);
+
+		// Odd while writing, the readers of the previous emission in the slot see it changed
+		sequence.store(2 * m_head + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		unsigned index = 0;
+		const int order[] = { 0, (memcpy(payload + m_offsets[index++], &args, sizeof(args)), 0)... };
+		(void)order;
+
+		sequence.store(2 * m_head + 2, std::memory_order_release);
+		mp_header->m_head.store(++m_head, std::memory_order_release);
+
+		// Pairs with the sleepers, which count themselves before checking the wakeups in the futex
+		mp_header->m_wakeups.fetch_add(1, std::memory_order_seq_cst);
+		if (mp_header->m_sleepers.load(std::memory_order_seq_cst) > 0)
+		{
+			detail::FutexWakeAll(mp_header->m_wakeups);
+		}
+	}
+
+	template<typename... Args>
+	CSharedSignalSubscriber<void(Args...)>::CSharedSignalSubscriber(const char* name) :
+		mp_header(0),
+		mp_slots(0),
+		m_segmentSize(0),
+		m_stride(0),
+		m_cursor(0),
+		m_lostCount(0)
+	{
+		const std::size_t payloadSize = detail::PayloadLayout<typename std::decay<Args>::type...>(m_offsets);
+		m_stride = detail::SharedSlotStride(payloadSize);
+
+		const int file = shm_open(name, O_RDWR, 0600);
+		if (file < 0) return;
+
+		struct stat status;
+		void* mapping = MAP_FAILED;
+		if (fstat(file, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(detail::SSharedRingHeader))
+		{
+			m_segmentSize = status.st_size;
+			mapping = mmap(0, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		}
+		close(file);
+
+		if (mapping == MAP_FAILED) return;
+
+		// Rejecting segments still being created or of other signatures
+		detail::SSharedRingHeader* header = static_cast<detail::SSharedRingHeader*>(mapping);
+		const bool isValid = header->m_magic == detail::kSharedRingMagic && header->m_payloadSize == payloadSize &&
+			m_segmentSize >= sizeof(detail::SSharedRingHeader) + header->m_capacity * m_stride;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (!isValid)
+		{
+			munmap(mapping, m_segmentSize);
+			return;
+		}
+
+		mp_header = header;
+		mp_slots = static_cast<char*>(mapping) + sizeof(detail::SSharedRingHeader);
+		mp_header->m_subscriberCount.fetch_add(1, std::memory_order_relaxed);
+		m_cursor = mp_header->m_head.load(std::memory_order_acquire);
+	}
+
+	template<typename... Args>
+	CSharedSignalSubscriber<void(Args...)>::~CSharedSignalSubscriber()
+	{
+		if (!mp_header) return;
+
+		mp_header->m_subscriberCount.fetch_sub(1, std::memory_order_relaxed);
+		munmap(mp_header, m_segmentSize);
+	}
+
+	template<typename... Args>
+	const unsigned CSharedSignalSubscriber<void(Args...)>::Dispatch()
+	{
+		if (!mp_header) return 0;
+
+		unsigned count = 0;
+		TPayload payload;
+		while (HasPending())
+		{
+			if (!Read(payload))
+			{
+				// Lapped by the publisher, jumping to the oldest emission still in the ring
+				const uint64_t head = mp_header->m_head.load(std::memory_order_acquire);
+				const uint64_t oldest = head > mp_header->m_capacity ? head - mp_header->m_capacity + 1 : 0;
+				if (oldest > m_cursor)
+				{
+					m_lostCount += oldest - m_cursor;
+					m_cursor = oldest;
+				}
+				continue;
+			}
+
+			++m_cursor;
+			++count;
+			Emit(payload, TIndices());
+		}
+		return count;
+	}
+
+	template<typename... Args>
+	const unsigned CSharedSignalSubscriber<void(Args...)>::Wait(const std::chrono::nanoseconds timeout)
+	{
+		if (!mp_header) return 0;
+
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+		while (true)
+		{
+			// Taking the wakeups before checking, an emission in between changes them and the futex doesn't sleep
+			const uint32_t wakeups = mp_header->m_wakeups.load(std::memory_order_seq_cst);
+			if (HasPending()) return Dispatch();
+
+			const std::chrono::nanoseconds left = deadline - std::chrono::steady_clock::now();
+			if (left.count() <= 0) return 0;
+
+			timespec wait;
+			wait.tv_sec = left.count() / 1000000000;
+			wait.tv_nsec = left.count() % 1000000000;
+
+			mp_header->m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+			detail::FutexWait(mp_header->m_wakeups, wakeups, &wait);
+			mp_header->m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+
+	template<typename... Args>
+	const bool CSharedSignalSubscriber<void(Args...)>::Read(TPayload& payload)
+	{
+		char* slot = mp_slots + (m_cursor & (mp_header->m_capacity - 1)) * m_stride;
+		const std::atomic<uint64_t>& sequence = detail::SharedSlotSequence(slot);
+		const uint64_t expected = 2 * m_cursor + 2;
+
+		if (sequence.load(std::memory_order_acquire) != expected) return false;
+
+		memcpy(&payload, slot + sizeof(std::atomic<uint64_t>), mp_header->m_payloadSize);
+
+		// The publisher didn't start writing it again while copying
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return sequence.load(std::memory_order_relaxed) == expected;
+	}
+}
+
+#endif
@@ -25,13 +25,36 @@
 
 #include <vector>
 #include <iterator>
+#include <stdexcept>
 #include <utility>
 #include <algorithm>
+#include <type_traits>
+#include <tuple>
 
 #include "connection.h"
+#include "index_sequence.h"
+#include "result_range.h"
+#include "pipeline.h"
 
 namespace dc
 {
+	template<typename TSignal>
+	class CSignalAwaiter;
+
+	namespace detail
+	{
+		template<typename TSignal>
+		class CAsyncEmitter;
+
+		// Tells if all the types can be copied
+		template<typename... Types>
+		struct TAreCopyable : std::true_type {};
+
+		template<typename Type, typename... Types>
+		struct TAreCopyable<Type, Types...> :
+			std::integral_constant<bool, std::is_copy_constructible<Type>::value && TAreCopyable<Types...>::value> {};
+	}
+
 	/*
 	 CSIGNAL
 	 
@@ -41,12 +64,50 @@ namespace dc
 	template<typename ReturnType, typename... Args>
 	class CSignal<ReturnType(Args...)>
 	{
+		template<typename TSignal>
+		friend class CSignalAwaiter;
+
+		template<typename TSignal>
+		friend class CResultRange;
+
+		template<typename TSignal>
+		friend class detail::CAsyncEmitter;
+
 		//---------------------------------------------------------------------
 		// Type definitions
 		//---------------------------------------------------------------------
 	public:
 		using TConnection = CConnection<ReturnType(Args...)>;
 		using TSignal = CSignal<ReturnType(Args...)>;
+		using TBinding = CSignalBinding<TSignal>;
+		using TRelays = SSignalRelays<TSignal>;
+
+	private:
+		// Counts the emission running in the binding while it's in scope, even if a slot throws
+		struct SEmissionScope
+		{
+			explicit SEmissionScope(TBinding* binding) : mp_binding(binding) { if (mp_binding) ++mp_binding->m_emissionDepth; }
+
+			~SEmissionScope() { if (mp_binding) --mp_binding->m_emissionDepth; }
+
+			TBinding* mp_binding;
+		};
+
+		// Waiters of the emission starting, taken from the signal so the ones linked by its slots wait for the
+		// next emission. They are linked to this list, so a waiter destroyed meanwhile unlinks itself from
+		// here, and they are given back to the signal if a slot throws before they are woken up.
+		struct SEmissionWaiters
+		{
+			explicit SEmissionWaiters(TBinding* binding);
+
+			~SEmissionWaiters();
+
+			SEmissionWaiters(const SEmissionWaiters& copy) = delete;
+			SEmissionWaiters& operator= (const SEmissionWaiters& copy) = delete;
+
+			TBinding*		mp_binding;
+			SSignalWaiter*	mp_waiters;
+		};
 		
 		//---------------------------------------------------------------------
 		// Getters / Setters
@@ -54,27 +115,49 @@ namespace dc
 	public:
 		const bool		IsEmpty() const	{ return Count() == 0; }
 
-		const unsigned	Count() const	{ return m_connections.size(); }
+		const unsigned	Count() const	{ return m_connections.size() - m_consumedCount; }
+
+		// The name is only used to identify the signal in statistics and traces
+		const char*		Name() const	{ return mp_binding ? mp_binding->mp_name : 0; }
+
+		void			SetName(const char* name);
+
+		// Number of connections that fit in the storage without growing it
+		const unsigned	Capacity() const	{ return m_connections.capacity(); }
+
+		const SSignalMemoryUsage MemoryUsage() const;
+
+		// Null unless the profiling is enabled
+		const CSlotProfiler* Profiler() const	{ return mp_binding ? mp_binding->mp_profiler : 0; }
 		
 		//---------------------------------------------------------------------
 		// Constructors / Destructors
 		//---------------------------------------------------------------------
 	public:
-		CSignal() {}
+		CSignal() : m_consumedCount(0), mp_binding(0) {}
 
-		~CSignal() { Clear(); }
+		~CSignal();
 		
-		CSignal(const TSignal& copy) : m_connections(copy.m_connections) { }
+		// Throws std::logic_error if an owned callable can't be copied
+		CSignal(const TSignal& copy);
 
-		CSignal(CSignal&& other) : TSignal() { swap(*this, other); }
+		// Moving only transfers the connections storage and the binding, so it is O(1) and
+		// signals can be kept in containers without invalidating the connections bound to them
+		CSignal(CSignal&& other) noexcept : TSignal() { swap(*this, other); }
 		
-		TSignal& operator= (TSignal signal);
+		TSignal& operator= (TSignal signal) noexcept;
 
 	private:
-		friend void swap(TSignal& first, TSignal& second)
+		friend void swap(TSignal& first, TSignal& second) noexcept
 		{
 			using std::swap;
 			swap(first.m_connections, second.m_connections);
+			swap(first.m_consumedCount, second.m_consumedCount);
+			swap(first.mp_binding, second.mp_binding);
+
+			// The bindings changed of owner, they must point to their new signals
+			if (first.mp_binding) first.mp_binding->mp_signal = &first;
+			if (second.mp_binding) second.mp_binding->mp_signal = &second;
 		}
 
 		//---------------------------------------------------------------------
@@ -94,6 +177,74 @@ namespace dc
 		template<typename T>
 		TConnection& Connect(const T* caller, ReturnType(T::* function) (Args...) const);
 		
+		/*
+		 One-shot connections are invoked by the first emission that reaches them and then dropped.
+		 They are only marked as consumed while dispatching and removed in a single pass after the emission,
+		 so firing n one-shot slots costs O(n) instead of a linear Disconnect per slot.
+		 */
+		template <typename T>
+		TConnection& ConnectOnce(const T& slotRef);
+
+		template <typename T>
+		TConnection& ConnectOnce(const T* slotPtr);
+
+		template<typename T>
+		TConnection& ConnectOnce(T* caller, ReturnType(T::* function) (Args...));
+
+		template<typename T>
+		TConnection& ConnectOnce(const T* caller, ReturnType(T::* function) (Args...) const);
+
+		/*
+		 Owned connections keep their own copy of the callable, so temporaries like lambdas can be connected
+		 without keeping them alive anywhere else. The copies are allocated in the slab allocator shared by all
+		 the signals. They can only be disconnected through the connection returned.
+		 */
+		template <typename T>
+		TConnection& ConnectOwned(T&& callable);
+
+		/*
+		 Observers receive const references to the arguments instead of their own copies. Signals can have
+		 arguments that can't be copied, like std::unique_ptr, as long as all the slots but one are observers:
+		 the last slot that isn't an observer is the sink, it's invoked after the rest and receives the
+		 arguments moved. With copyable arguments the slots before the sink still get copies.
+		 Observers are disconnected through the returned connection, by reference for functors, or with
+		 DisconnectObserver for member functions.
+		 */
+		template <typename T>
+		TConnection& ConnectObserver(const T& slotRef);
+
+		TConnection& ConnectObserver(ReturnType(*function) (const typename std::decay<Args>::type&...));
+
+		template<typename T>
+		TConnection& ConnectObserver(T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...));
+
+		template<typename T>
+		TConnection& ConnectObserver(const T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...) const);
+
+		/*
+		 Forwards the emissions of this signal to another one. Emitting a relay chain is a single loop over
+		 the slots of all its signals, flattened when the chain changes, so forwarding costs the same as
+		 connecting the slots directly. Signals with one-shot connections or coroutines waiting are not
+		 flattened, they are emitted from the chain instead.
+		 The forwarding is removed when the other signal is destroyed.
+		 */
+		TConnection& ConnectSignal(TSignal& signal);
+
+		void DisconnectSignal(TSignal& signal);
+
+		/*
+		 Operators over the emissions, see CPipeline. Nothing is connected until the pipeline is:
+
+			signal.Filter(isEven).Map(half).Take(3).Connect(slot);
+		 */
+		template<typename TPredicate>
+		CPipeline<TSignal, detail::SFilter<typename std::decay<TPredicate>::type>> Filter(TPredicate&& predicate);
+
+		template<typename TFunction>
+		CPipeline<TSignal, detail::SMap<typename std::decay<TFunction>::type>> Map(TFunction&& function);
+
+		CPipeline<TSignal, detail::STake> Take(const unsigned count);
+
 		template<typename T>
 		void Disconnect(const T& slotRef);
 		
@@ -106,9 +257,29 @@ namespace dc
 		template<typename T>
 		void Disconnect(const T* caller, ReturnType(T::* function) (Args...) const);
 
+		template<typename T>
+		void DisconnectObserver(T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...));
+
+		template<typename T>
+		void DisconnectObserver(const T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...) const);
+
 		void Disconnect(const TConnection& connection);
 		
 		void Clear();
+
+		// Grows the storage of the connections before a bulk of connections
+		void Reserve(const unsigned count);
+
+		// Releases the storage not used by the connections, like after disconnecting many of them
+		void ShrinkToFit();
+
+		/*
+		 Times the slots on one emission out of every 'sampleRate', see CSlotProfiler.
+		 The threshold is the number of cycles above which a slot is reported as slow.
+		 */
+		void EnableProfiling(const unsigned sampleRate, const TCycles threshold);
+
+		void DisableProfiling();
 		
 		const bool operator() (Args... args);
 
@@ -119,14 +290,203 @@ namespace dc
 		
 		template<typename TArray>
 		const bool operator() (TArray& valuesArray, Args... args) const;
+
+		/*
+		 Emits with the values returned by the factories, one per argument. They are only invoked if somebody
+		 listens to the signal, and only once for all the slots, so building expensive payloads for signals
+		 nobody observes costs nothing:
+
+			signal.EmitLazy([&]() { return FormatReport(state); });
+
+		 Returns false when the signal had no listeners and nothing was built.
+		 */
+		template<typename... TFactories>
+		const bool EmitLazy(TFactories&&... factories);
+
+		template<typename... TFactories>
+		const bool EmitLazy(TFactories&&... factories) const;
+
+		/*
+		 Emission returning a lazy range over the values of the slots. Every slot is invoked when the range
+		 reaches it and is dereferenced, so stopping the iteration early skips the slots left:
+
+			for (const bool isHandled : signal.Results(path)) if (isHandled) break;
+		 */
+		CResultRange<TSignal> Results(Args... args) const;
 		
+	private:
+		// Lazily creates the binding shared by the connections of this signal
+		TBinding* Binding();
+
+		TConnection& Add(TConnection&& connection);
+
+		// Reports the changes of the heap memory used by the signal to CSignalMemory
+		void UpdateMemoryAccounting();
+
+		TConnection& MarkOneShot(TConnection& connection);
+
+		// Tells if the connection has to be invoked, consuming it when it is a one-shot connection
+		const bool Acquire(const TConnection& connection) const;
+
+		// Removes the consumed one-shot connections in a single pass
+		void RemoveConsumed();
+
+		// First connection from index not consumed yet
+		const unsigned NextPending(unsigned index) const;
+
+		// The profiler if the current emission has to be timed, null otherwise
+		CSlotProfiler* SampledProfiler() const;
+
+		// Invokes the slots storing their values in the array
+		template<typename TArray>
+		void Collect(TArray& valuesArray, typename std::add_lvalue_reference<Args>::type... args) const;
+
+		// Invokes the slots with references to the arguments, except the sink which is the last one invoked
+		// and receives them moved, unless there are waiters that still need them
+		void Dispatch(const bool isAwaited, typename std::add_lvalue_reference<Args>::type... args) const;
+
+		// Invokes the leaf slots of the relay chain starting in this signal
+		void DispatchFlattened(typename std::add_lvalue_reference<Args>::type... args) const;
+
+		const bool HasRelays() const { return mp_binding && mp_binding->mp_relays && mp_binding->mp_relays->m_relayCount > 0; }
+
+		static TRelays* Relays(TBinding* binding);
+
+		// Registers this signal as upstream of the signal the relay connection forwards to
+		void Link(const TConnection& relay);
+
+		void Unlink(const TConnection& relay);
+
+		// Removes the relay connections forwarding to the binding
+		void RemoveRelaysTo(const TBinding* target);
+
+		// Tells if the binding forwards, directly or not, to the target
+		static const bool Reaches(const TBinding* binding, const TBinding* target);
+
+		// Called when the connections change, the signals forwarding to this one have to flatten their chains again
+		void Invalidate() const { if (mp_binding) Invalidate(mp_binding); }
+
+		static void Invalidate(TBinding* binding);
+
+		const std::vector<typename TRelays::SFlattenedSlot>& Flattened() const;
+
+		static void Flatten(const TSignal& signal, std::vector<typename TRelays::SFlattenedSlot>& leaves);
+
+		// The slots of signals with one-shot connections or coroutines waiting must be dispatched by them
+		const bool IsFlattenable() const;
+
+		// Last pending connection that isn't an observer, or the count of connections if there is none
+		const unsigned Sink() const;
+
+		// Invokes a connection before the sink, copying the arguments if it isn't an observer
+		void Deliver(const TConnection& connection, std::true_type areCopyable, typename std::add_lvalue_reference<Args>::type... args) const;
+
+		void Deliver(const TConnection& connection, std::false_type areCopyable, typename std::add_lvalue_reference<Args>::type... args) const;
+
+		// Connections left to invoke or coroutines waiting
+		const bool HasListeners() const { return Count() > 0 || (mp_binding && mp_binding->mp_waiters); }
+
+		template<typename TArguments, unsigned... Indices>
+		const bool EmitTuple(TArguments& arguments, detail::TIndexSequence<Indices...> indices) { return (*this)(std::get<Indices>(arguments)...); }
+
+		template<typename TArguments, unsigned... Indices>
+		const bool EmitTuple(TArguments& arguments, detail::TIndexSequence<Indices...> indices) const { return (*this)(std::get<Indices>(arguments)...); }
+
+		// Wakes up the waiters of this emission, see CSignalAwaiter
+		static void NotifyWaiters(SEmissionWaiters& waiters, typename std::add_lvalue_reference<Args>::type... args);
+
+		// Invokes the connection with the arguments stored in a tuple
+		template<typename TArguments, unsigned... Indices>
+		static ReturnType Invoke(const TConnection& connection, TArguments& arguments, detail::TIndexSequence<Indices...> indices);
+
 	private:
 		std::vector<TConnection> m_connections;
 
+		// Consumed one-shot connections still kept in m_connections.
+		// Const emissions can't remove them, so they wait until the next non-const operation.
+		mutable unsigned m_consumedCount;
+
+		TBinding* mp_binding;
+
 	};
 
 	template<typename ReturnType, typename... Args>
-	CSignal<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::operator= (TSignal signal)
+	CSignal<ReturnType(Args...)>::~CSignal()
+	{
+		// The signals forwarding to this one stop doing it
+		while (mp_binding && mp_binding->mp_relays && !mp_binding->mp_relays->m_upstreams.empty())
+		{
+			TBinding* upstream = mp_binding->mp_relays->m_upstreams.back();
+			upstream->mp_signal->RemoveRelaysTo(mp_binding);
+		}
+
+		Clear();
+		if (mp_binding)
+		{
+			// The waiters left will never be woken up
+			for (SSignalWaiter* waiter = mp_binding->mp_waiters; waiter; waiter = waiter->mp_next)
+			{
+				waiter->mp_list = 0;
+			}
+			CSignalMemory::Remove(mp_binding->m_accountedBytes);
+			delete mp_binding;
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>::CSignal(const TSignal& copy) :
+		m_connections(copy.m_connections),
+		m_consumedCount(copy.m_consumedCount),
+		mp_binding(0)
+	{
+		// Checked before taking anything, the destructor doesn't run when the constructor throws
+		for (const TConnection& connection : copy.m_connections)
+		{
+			if (connection.mp_owned && !connection.mp_owned->mp_clone)
+			{
+				throw std::logic_error("Copying a signal with a callable that can't be copied");
+			}
+		}
+
+		// The copied connections still point to the original signal
+		if (m_connections.empty()) return;
+
+		TBinding* binding = Binding();
+		if (copy.Name())
+		{
+			SetName(copy.Name());
+		}
+
+		for (unsigned i = 0; i < m_connections.size(); ++i)
+		{
+			TConnection& connection = m_connections[i];
+			connection.mp_binding = binding;
+
+			// Every signal keeps its own copy of the owned callables
+			if (const SOwnedCallable* owned = copy.m_connections[i].mp_owned)
+			{
+				connection.Own(owned->mp_clone(owned));
+			}
+
+			if (connection.m_isRelay)
+			{
+				Link(connection);
+			}
+		}
+		UpdateMemoryAccounting();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::SetName(const char* name)
+	{
+		Binding()->mp_name = name;
+#if defined(DCPP_SIGNALS_INSTRUMENTATION)
+		mp_binding->m_stats.SetName(name);
+#endif
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::operator= (TSignal signal) noexcept
 	{
 		// Using copy-and-swap idiom
 		swap(*this, signal);
@@ -138,24 +498,21 @@ namespace dc
 	template <typename T>
 	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::Connect(const T& slotRef)
 	{
-		m_connections.push_back(TConnection(this, const_cast<T&>(slotRef)));
-		return m_connections.back();
+		return Add(TConnection(Binding(), const_cast<T&>(slotRef)));
 	}
 
 	template<typename ReturnType, typename... Args>
 	template <typename T>
 	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::Connect(const T* slotPtr)
 	{
-		m_connections.push_back(TConnection(this, const_cast<T*>(slotPtr)));
-		return m_connections.back();
+		return Add(TConnection(Binding(), const_cast<T*>(slotPtr)));
 	}
 
 	template<typename ReturnType, typename... Args>
 	template<typename T>
 	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::Connect(T* caller, ReturnType(T::* function) (Args...))
 	{
-		m_connections.push_back(TConnection(this, caller, function));
-		return m_connections.back();
+		return Add(TConnection(Binding(), caller, function));
 	}
 
 	template<typename ReturnType, typename... Args>
@@ -164,8 +521,122 @@ namespace dc
 	{
 		// Since we know that the member function is const, it's safe to
 		// remove the const qualifier from the 'caller' pointer with a const_cast.
-		m_connections.push_back(TConnection(this, const_cast<T*>(caller), function));
-		return m_connections.back();
+		return Add(TConnection(Binding(), const_cast<T*>(caller), function));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectOnce(const T& slotRef)
+	{
+		return MarkOneShot(Connect(slotRef));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectOnce(const T* slotPtr)
+	{
+		return MarkOneShot(Connect(slotPtr));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectOnce(T* caller, ReturnType(T::* function) (Args...))
+	{
+		return MarkOneShot(Connect(caller, function));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectOnce(const T* caller, ReturnType(T::* function) (Args...) const)
+	{
+		return MarkOneShot(Connect(caller, function));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectOwned(T&& callable)
+	{
+		using TCallable = typename std::decay<T>::type;
+		return Add(TConnection(Binding(), COwnedCallable<TCallable>::Create(std::forward<T>(callable))));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename TPredicate>
+	CPipeline<CSignal<ReturnType(Args...)>, detail::SFilter<typename std::decay<TPredicate>::type>> CSignal<ReturnType(Args...)>::Filter(TPredicate&& predicate)
+	{
+		static_assert(std::is_void<ReturnType>::value, "Only signals returning void can be piped");
+		return CPipeline<TSignal>(*this, std::tuple<>()).Filter(std::forward<TPredicate>(predicate));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename TFunction>
+	CPipeline<CSignal<ReturnType(Args...)>, detail::SMap<typename std::decay<TFunction>::type>> CSignal<ReturnType(Args...)>::Map(TFunction&& function)
+	{
+		static_assert(std::is_void<ReturnType>::value, "Only signals returning void can be piped");
+		return CPipeline<TSignal>(*this, std::tuple<>()).Map(std::forward<TFunction>(function));
+	}
+
+	template<typename ReturnType, typename... Args>
+	CPipeline<CSignal<ReturnType(Args...)>, detail::STake> CSignal<ReturnType(Args...)>::Take(const unsigned count)
+	{
+		static_assert(std::is_void<ReturnType>::value, "Only signals returning void can be piped");
+		return CPipeline<TSignal>(*this, std::tuple<>()).Take(count);
+	}
+
+	template<typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectObserver(const T& slotRef)
+	{
+		return Add(TConnection(Binding(), const_cast<T&>(slotRef), typename TConnection::SObserver()));
+	}
+
+	template<typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectObserver(ReturnType(*function) (const typename std::decay<Args>::type&...))
+	{
+		return Add(TConnection(Binding(), function, typename TConnection::SObserver()));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectObserver(T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...))
+	{
+		return Add(TConnection(Binding(), caller, function, typename TConnection::SObserver()));
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectObserver(const T* caller, ReturnType(T::* function) (const typename std::decay<Args>::type&...) const)
+	{
+		return Add(TConnection(Binding(), const_cast<T*>(caller), function, typename TConnection::SObserver()));
+	}
+
+	template<typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::ConnectSignal(TSignal& signal)
+	{
+		static_assert(std::is_void<ReturnType>::value, "Only signals returning void can be forwarded");
+		static_assert(detail::TAreCopyable<Args...>::value, "Signals with arguments that can't be copied can't be forwarded");
+
+		TBinding* target = signal.Binding();
+		assert(!Reaches(target, Binding()) && "Forwarding to the signal would create a cycle");
+
+		TConnection& connection = Add(TConnection(Binding(), target, typename TConnection::SRelay()));
+		Link(connection);
+		return connection;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::DisconnectSignal(TSignal& signal)
+	{
+		if (!signal.mp_binding) return;
+
+		for (const TConnection& connection : m_connections)
+		{
+			if (connection.m_isRelay && connection.RelayTarget() == signal.mp_binding)
+			{
+				Disconnect(connection);
+				return;
+			}
+		}
 	}
 
 	template<typename ReturnType, typename... Args>
@@ -175,7 +646,7 @@ namespace dc
 		T& nonConstRef = const_cast<T&>(ref);
 		for (const auto& connection : m_connections)
 		{
-			if (connection.Equals(nonConstRef))
+			if (!connection.m_isConsumed && connection.Equals(nonConstRef))
 			{
 				Disconnect(connection);
 				return;
@@ -190,7 +661,7 @@ namespace dc
 		T* nonConstPtr = const_cast<T*>(ptr);
 		for (const auto& connection : m_connections)
 		{
-			if (connection.Equals(nonConstPtr))
+			if (!connection.m_isConsumed && connection.Equals(nonConstPtr))
 			{
 				Disconnect(connection);
 				return;
@@ -204,7 +675,7 @@ namespace dc
 	{
 		for (const auto& connection : m_connections)
 		{
-			if (connection.Equals(ptr, function))
+			if (!connection.m_isConsumed && connection.Equals(ptr, function))
 			{
 				Disconnect(connection);
 				return;
@@ -221,7 +692,36 @@ namespace dc
 		T* nonConstPtr = const_cast<T*>(ptr);
 		for (const auto& connection : m_connections)
 		{
-			if (connection.Equals(nonConstPtr, function))
+			if (!connection.m_isConsumed && connection.Equals(nonConstPtr, function))
+			{
+				Disconnect(connection);
+				return;
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignal<ReturnType(Args...)>::DisconnectObserver(T* ptr, ReturnType(T::* function) (const typename std::decay<Args>::type&...))
+	{
+		for (const auto& connection : m_connections)
+		{
+			if (!connection.m_isConsumed && connection.Equals(ptr, function))
+			{
+				Disconnect(connection);
+				return;
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignal<ReturnType(Args...)>::DisconnectObserver(const T* ptr, ReturnType(T::* function) (const typename std::decay<Args>::type&...) const)
+	{
+		T* nonConstPtr = const_cast<T*>(ptr);
+		for (const auto& connection : m_connections)
+		{
+			if (!connection.m_isConsumed && connection.Equals(nonConstPtr, function))
 			{
 				Disconnect(connection);
 				return;
@@ -235,32 +735,131 @@ namespace dc
 		const auto& end = m_connections.end();
 		const auto& it = std::find(m_connections.begin(), end, connection);
 
+		// The connection could have been consumed and removed already
+		if (it == end) return;
+
+		if (it->m_isConsumed)
+		{
+			--m_consumedCount;
+		}
+		if (it->m_isRelay)
+		{
+			Unlink(*it);
+		}
 		m_connections.erase(it);
+		Invalidate();
 	}
 
 	template<typename ReturnType, typename... Args>
 	void CSignal<ReturnType(Args...)>::Clear()
 	{
+		if (HasRelays())
+		{
+			for (const TConnection& connection : m_connections)
+			{
+				if (connection.m_isRelay) Unlink(connection);
+			}
+		}
 		m_connections.clear();
+		m_consumedCount = 0;
+		Invalidate();
 	}
 
 	template<typename ReturnType, typename... Args>
-	const bool CSignal<ReturnType(Args...)>::operator() (Args... args)
+	const SSignalMemoryUsage CSignal<ReturnType(Args...)>::MemoryUsage() const
 	{
+		SSignalMemoryUsage usage;
+		usage.signal = sizeof(TSignal);
+		usage.connections = m_connections.capacity() * sizeof(TConnection);
+		usage.binding = 0;
+		usage.callables = 0;
+
+		if (mp_binding)
+		{
+			usage.binding = sizeof(TBinding);
+			if (mp_binding->mp_profiler)
+			{
+				usage.binding += sizeof(CSlotProfiler);
+			}
+		}
+
 		for (const TConnection& connection : m_connections)
 		{
-			connection(args...);
+			if (connection.mp_owned)
+			{
+				usage.callables += connection.mp_owned->m_size;
+			}
+		}
+		return usage;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Reserve(const unsigned count)
+	{
+		// The binding keeps the accounting of the heap memory
+		Binding();
+		m_connections.reserve(count);
+		UpdateMemoryAccounting();
+		Invalidate();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::ShrinkToFit()
+	{
+		RemoveConsumed();
+		m_connections.shrink_to_fit();
+		if (mp_binding)
+		{
+			UpdateMemoryAccounting();
+			Invalidate();
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::EnableProfiling(const unsigned sampleRate, const TCycles threshold)
+	{
+		TBinding* binding = Binding();
+		delete binding->mp_profiler;
+		binding->mp_profiler = new CSlotProfiler(sampleRate, threshold);
+		UpdateMemoryAccounting();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::DisableProfiling()
+	{
+		if (!mp_binding) return;
+
+		delete mp_binding->mp_profiler;
+		mp_binding->mp_profiler = 0;
+		UpdateMemoryAccounting();
+	}
+
+	template<typename ReturnType, typename... Args>
+	const bool CSignal<ReturnType(Args...)>::operator() (Args... args)
+	{
+		DCPP_SIGNALS_PROBE_EMIT(mp_binding);
+		DCPP_SIGNALS_TRACE_EMIT(mp_binding);
+		SEmissionWaiters waiters(mp_binding);
+		{
+			SEmissionScope scope(mp_binding);
+			Dispatch(waiters.mp_waiters != 0, args...);
 		}
+		RemoveConsumed();
+		NotifyWaiters(waiters, args...);
 		return true;
 	}
 
 	template<typename ReturnType, typename... Args>
 	const bool CSignal<ReturnType(Args...)>::operator() (Args... args) const
 	{
-		for (const TConnection& connection : m_connections)
+		DCPP_SIGNALS_PROBE_EMIT(mp_binding);
+		DCPP_SIGNALS_TRACE_EMIT(mp_binding);
+		SEmissionWaiters waiters(mp_binding);
 		{
-			connection(args...);
+			SEmissionScope scope(mp_binding);
+			Dispatch(waiters.mp_waiters != 0, args...);
 		}
+		NotifyWaiters(waiters, args...);
 		return true;
 	}
 
@@ -268,23 +867,453 @@ namespace dc
 	template<typename TArray>
 	const bool CSignal<ReturnType(Args...)>::operator() (TArray& valuesArray, Args... args)
 	{
-		int index = 0;
-		for (const TConnection& connection : m_connections)
+		DCPP_SIGNALS_PROBE_EMIT(mp_binding);
+		DCPP_SIGNALS_TRACE_EMIT(mp_binding);
+		SEmissionWaiters waiters(mp_binding);
+		Collect(valuesArray, args...);
+		RemoveConsumed();
+		NotifyWaiters(waiters, args...);
+		return true;
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename TArray>
+	const bool CSignal<ReturnType(Args...)>::operator() (TArray& valuesArray, Args... args) const
+	{
+		DCPP_SIGNALS_PROBE_EMIT(mp_binding);
+		DCPP_SIGNALS_TRACE_EMIT(mp_binding);
+		SEmissionWaiters waiters(mp_binding);
+		Collect(valuesArray, args...);
+		NotifyWaiters(waiters, args...);
+		return true;
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename... TFactories>
+	const bool CSignal<ReturnType(Args...)>::EmitLazy(TFactories&&... factories)
+	{
+		static_assert(sizeof...(TFactories) == sizeof...(Args), "There must be a factory for every argument");
+
+		if (!HasListeners()) return false;
+
+		// The braced initialization invokes the factories in order
+		std::tuple<decltype(factories())...> arguments{ factories()... };
+		return EmitTuple(arguments, typename detail::TMakeIndexSequence<sizeof...(Args)>::TType());
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename... TFactories>
+	const bool CSignal<ReturnType(Args...)>::EmitLazy(TFactories&&... factories) const
+	{
+		static_assert(sizeof...(TFactories) == sizeof...(Args), "There must be a factory for every argument");
+
+		if (!HasListeners()) return false;
+
+		std::tuple<decltype(factories())...> arguments{ factories()... };
+		return EmitTuple(arguments, typename detail::TMakeIndexSequence<sizeof...(Args)>::TType());
+	}
+
+	template<typename ReturnType, typename... Args>
+	CResultRange<CSignal<ReturnType(Args...)>> CSignal<ReturnType(Args...)>::Results(Args... args) const
+	{
+		DCPP_SIGNALS_PROBE_EMIT(mp_binding);
+		return CResultRange<TSignal>(*this, args...);
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>::SEmissionWaiters::SEmissionWaiters(TBinding* binding) :
+		mp_binding(binding),
+		mp_waiters(0)
+	{
+		if (!mp_binding || !mp_binding->mp_waiters) return;
+
+		// Reversed to wake them up in order of arrival
+		SSignalWaiter* waiter = mp_binding->mp_waiters;
+		mp_binding->mp_waiters = 0;
+		while (waiter)
+		{
+			SSignalWaiter* next = waiter->mp_next;
+			waiter->mp_next = mp_waiters;
+			waiter->mp_list = &mp_waiters;
+			mp_waiters = waiter;
+			waiter = next;
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignal<ReturnType(Args...)>::SEmissionWaiters::~SEmissionWaiters()
+	{
+		// Only when a slot threw, the waiters go on waiting in the signal
+		while (mp_waiters)
+		{
+			SSignalWaiter* waiter = mp_waiters;
+			mp_waiters = waiter->mp_next;
+			waiter->mp_next = mp_binding->mp_waiters;
+			waiter->mp_list = &mp_binding->mp_waiters;
+			mp_binding->mp_waiters = waiter;
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	inline void CSignal<ReturnType(Args...)>::NotifyWaiters(SEmissionWaiters& waiters, typename std::add_lvalue_reference<Args>::type... args)
+	{
+		if (!waiters.mp_waiters) return;
+
+		// Nothing of the signal is used from here, a waiter could destroy it
+		std::tuple<typename std::add_lvalue_reference<Args>::type...> arguments(args...);
+		while (waiters.mp_waiters)
+		{
+			SSignalWaiter* waiter = waiters.mp_waiters;
+			waiters.mp_waiters = waiter->mp_next;
+			waiter->mp_list = 0;
+			waiter->mp_notify(waiter, &arguments);
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	template<typename TArguments, unsigned... Indices>
+	inline ReturnType CSignal<ReturnType(Args...)>::Invoke(const TConnection& connection, TArguments& arguments, detail::TIndexSequence<Indices...> indices)
+	{
+		return connection(std::get<Indices>(arguments)...);
+	}
+
+	template<typename ReturnType, typename... Args>
+	CSignalBinding<CSignal<ReturnType(Args...)>>* CSignal<ReturnType(Args...)>::Binding()
+	{
+		if (!mp_binding)
+		{
+			mp_binding = new TBinding(this);
+			UpdateMemoryAccounting();
+		}
+		return mp_binding;
+	}
+
+	template<typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::Add(TConnection&& connection)
+	{
+		const unsigned capacity = m_connections.capacity();
+		m_connections.push_back(std::move(connection));
+		if (capacity != m_connections.capacity())
 		{
-			valuesArray[index++] = connection(args...);
+			UpdateMemoryAccounting();
+		}
+
+		DCPP_SIGNALS_PROBE_CONNECTIONS(mp_binding, Count());
+		Invalidate();
+		return m_connections.back();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::UpdateMemoryAccounting()
+	{
+		// The owned callables add themselves to CSignalMemory while they live
+		const SSignalMemoryUsage usage = MemoryUsage();
+		const std::size_t bytes = usage.connections + usage.binding;
+		std::size_t& accountedBytes = Binding()->m_accountedBytes;
+
+		if (bytes > accountedBytes) CSignalMemory::Add(bytes - accountedBytes);
+		else CSignalMemory::Remove(accountedBytes - bytes);
+
+		accountedBytes = bytes;
+	}
+
+	template<typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CSignal<ReturnType(Args...)>::MarkOneShot(TConnection& connection)
+	{
+		connection.m_isOneShot = true;
+
+		// Signals with one-shot connections are not flattened
+		Invalidate();
+		return connection;
+	}
+
+	template<typename ReturnType, typename... Args>
+	inline const bool CSignal<ReturnType(Args...)>::Acquire(const TConnection& connection) const
+	{
+		if (connection.m_isConsumed) return false;
+
+		// Consumed before the call so a reentrant emission from the slot doesn't invoke it twice
+		if (connection.m_isOneShot)
+		{
+			connection.m_isConsumed = true;
+			++m_consumedCount;
 		}
 		return true;
 	}
 
+	template<typename ReturnType, typename... Args>
+	inline CSlotProfiler* CSignal<ReturnType(Args...)>::SampledProfiler() const
+	{
+		CSlotProfiler* profiler = mp_binding ? mp_binding->mp_profiler : 0;
+		return profiler && profiler->Sample() ? profiler : 0;
+	}
+
 	template<typename ReturnType, typename... Args>
 	template<typename TArray>
-	const bool CSignal<ReturnType(Args...)>::operator() (TArray& valuesArray, Args... args) const
+	void CSignal<ReturnType(Args...)>::Collect(TArray& valuesArray, typename std::add_lvalue_reference<Args>::type... args) const
 	{
+		SEmissionScope scope(mp_binding);
+		CSlotProfiler* profiler = SampledProfiler();
+
+		// The connections made by the slots are not part of this emission
+		const unsigned count = m_connections.size();
 		int index = 0;
+		for (unsigned i = 0; i < count; ++i)
+		{
+			const TConnection& connection = m_connections[i];
+			if (Acquire(connection))
+			{
+				DCPP_SIGNALS_PROBE_SLOT(mp_binding);
+				DCPP_SIGNALS_TRACE_SLOT(connection);
+				CSlotSample sample(profiler, connection);
+				valuesArray[index++] = connection(args...);
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Dispatch(const bool isAwaited, typename std::add_lvalue_reference<Args>::type... args) const
+	{
+		using TAreCopyable = detail::TAreCopyable<Args...>;
+
+		if (HasRelays())
+		{
+			DispatchFlattened(args...);
+			return;
+		}
+
+		CSlotProfiler* profiler = SampledProfiler();
+
+		// The connections made by the slots are not part of this emission
+		const unsigned count = m_connections.size();
+		const unsigned sink = Sink();
+		for (unsigned i = 0; i < count; ++i)
+		{
+			const TConnection& connection = m_connections[i];
+			if (i != sink && Acquire(connection))
+			{
+				DCPP_SIGNALS_PROBE_SLOT(mp_binding);
+				DCPP_SIGNALS_TRACE_SLOT(connection);
+				CSlotSample sample(profiler, connection);
+				Deliver(connection, TAreCopyable(), args...);
+			}
+		}
+
+		if (sink < count && Acquire(m_connections[sink]))
+		{
+			const TConnection& connection = m_connections[sink];
+			DCPP_SIGNALS_PROBE_SLOT(mp_binding);
+			DCPP_SIGNALS_TRACE_SLOT(connection);
+			CSlotSample sample(profiler, connection);
+
+			// The coroutines waiting still need the values after the sink, they can only await copyable ones
+			assert((TAreCopyable::value || !isAwaited) && "Nothing can wait for arguments that can't be copied, the sink takes them");
+			if (TAreCopyable::value && isAwaited)
+			{
+				Deliver(connection, TAreCopyable(), args...);
+			}
+			else
+			{
+				connection(std::forward<Args>(args)...);
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::DispatchFlattened(typename std::add_lvalue_reference<Args>::type... args) const
+	{
+		CSlotProfiler* profiler = SampledProfiler();
+		const std::vector<typename TRelays::SFlattenedSlot>& leaves = Flattened();
+		const unsigned count = leaves.size();
+		for (unsigned i = 0; i < count; ++i)
+		{
+			// The slots may connect to any signal of the chain, so each connection is looked up again
+			const std::vector<TConnection>& connections = leaves[i].mp_binding->mp_signal->m_connections;
+			if (leaves[i].m_index >= connections.size()) continue;
+
+			const TConnection& connection = connections[leaves[i].m_index];
+			if (Acquire(connection))
+			{
+				DCPP_SIGNALS_PROBE_SLOT(mp_binding);
+				DCPP_SIGNALS_TRACE_SLOT(connection);
+				CSlotSample sample(profiler, connection);
+				Deliver(connection, detail::TAreCopyable<Args...>(), args...);
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	SSignalRelays<CSignal<ReturnType(Args...)>>* CSignal<ReturnType(Args...)>::Relays(TBinding* binding)
+	{
+		if (!binding->mp_relays)
+		{
+			binding->mp_relays = new TRelays();
+		}
+		return binding->mp_relays;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Link(const TConnection& relay)
+	{
+		Relays(relay.RelayTarget())->m_upstreams.push_back(mp_binding);
+		++Relays(mp_binding)->m_relayCount;
+		Invalidate();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Unlink(const TConnection& relay)
+	{
+		std::vector<TBinding*>& upstreams = relay.RelayTarget()->mp_relays->m_upstreams;
+		upstreams.erase(std::find(upstreams.begin(), upstreams.end(), mp_binding));
+		--mp_binding->mp_relays->m_relayCount;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::RemoveRelaysTo(const TBinding* target)
+	{
+		const auto& isRelayToTarget = [target](const TConnection& connection)
+		{
+			return connection.m_isRelay && connection.RelayTarget() == target;
+		};
+
+		for (const TConnection& connection : m_connections)
+		{
+			if (isRelayToTarget(connection)) Unlink(connection);
+		}
+
+		const auto& end = m_connections.end();
+		m_connections.erase(std::remove_if(m_connections.begin(), end, isRelayToTarget), end);
+		Invalidate();
+	}
+
+	template<typename ReturnType, typename... Args>
+	const bool CSignal<ReturnType(Args...)>::Reaches(const TBinding* binding, const TBinding* target)
+	{
+		if (binding == target) return true;
+		if (!binding->mp_relays || binding->mp_relays->m_relayCount == 0) return false;
+
+		for (const TConnection& connection : binding->mp_signal->m_connections)
+		{
+			if (connection.m_isRelay && Reaches(connection.RelayTarget(), target)) return true;
+		}
+		return false;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Invalidate(TBinding* binding)
+	{
+		TRelays* relays = binding->mp_relays;
+		if (!relays) return;
+
+		relays->m_isFlattened = false;
+		for (TBinding* upstream : relays->m_upstreams)
+		{
+			Invalidate(upstream);
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	const std::vector<typename CSignal<ReturnType(Args...)>::TRelays::SFlattenedSlot>& CSignal<ReturnType(Args...)>::Flattened() const
+	{
+		// A reentrant emission keeps the slots of the outer one, which is still iterating over them
+		TRelays* relays = mp_binding->mp_relays;
+		if (!relays->m_isFlattened && mp_binding->m_emissionDepth <= 1)
+		{
+			relays->m_flattened.clear();
+			Flatten(*this, relays->m_flattened);
+			relays->m_isFlattened = true;
+		}
+		return relays->m_flattened;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::Flatten(const TSignal& signal, std::vector<typename TRelays::SFlattenedSlot>& leaves)
+	{
+		const unsigned count = signal.m_connections.size();
+		for (unsigned i = 0; i < count; ++i)
+		{
+			const TConnection& connection = signal.m_connections[i];
+			if (connection.m_isConsumed) continue;
+
+			const TSignal* target = connection.m_isRelay ? connection.RelayTarget()->mp_signal : 0;
+			if (target && target->IsFlattenable())
+			{
+				Flatten(*target, leaves);
+			}
+			else
+			{
+				leaves.push_back({ signal.mp_binding, i });
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	const bool CSignal<ReturnType(Args...)>::IsFlattenable() const
+	{
+		if (mp_binding && mp_binding->mp_waiters) return false;
+
 		for (const TConnection& connection : m_connections)
 		{
-			valuesArray[index++] = connection(args...);
+			if (connection.m_isOneShot) return false;
 		}
 		return true;
 	}
+
+	template<typename ReturnType, typename... Args>
+	inline const unsigned CSignal<ReturnType(Args...)>::Sink() const
+	{
+		for (unsigned i = m_connections.size(); i > 0; --i)
+		{
+			const TConnection& connection = m_connections[i - 1];
+			if (!connection.m_isConsumed && !connection.m_isObserver) return i - 1;
+		}
+		return m_connections.size();
+	}
+
+	template<typename ReturnType, typename... Args>
+	inline void CSignal<ReturnType(Args...)>::Deliver(const TConnection& connection, std::true_type areCopyable, typename std::add_lvalue_reference<Args>::type... args) const
+	{
+		if (connection.m_isObserver)
+		{
+			connection.Observe(args...);
+		}
+		else
+		{
+			connection(args...);
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	inline void CSignal<ReturnType(Args...)>::Deliver(const TConnection& connection, std::false_type areCopyable, typename std::add_lvalue_reference<Args>::type... args) const
+	{
+		assert(connection.m_isObserver && "Only one slot can take the arguments that can't be copied, the rest must be observers");
+		connection.Observe(args...);
+	}
+
+	template<typename ReturnType, typename... Args>
+	const unsigned CSignal<ReturnType(Args...)>::NextPending(unsigned index) const
+	{
+		while (index < m_connections.size() && m_connections[index].m_isConsumed)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CSignal<ReturnType(Args...)>::RemoveConsumed()
+	{
+		// The emissions running still index the connections
+		if (m_consumedCount == 0 || (mp_binding && mp_binding->m_emissionDepth > 0)) return;
+
+		const auto& end = m_connections.end();
+		const auto& it = std::remove_if(m_connections.begin(), end, [](const TConnection& connection)
+		{
+			return connection.m_isConsumed;
+		});
+
+		m_connections.erase(it, end);
+		m_consumedCount = 0;
+		Invalidate();
+	}
 }
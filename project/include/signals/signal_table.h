@@ -0,0 +1,350 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * signal_table.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "signal.h"
+
+namespace dc
+{
+	template<typename TEnum, typename Signature, unsigned KeyCount = static_cast<unsigned>(TEnum::Count)>
+	class CSignalTable;
+
+	/*
+	 CSIGNALTABLE
+
+	 A set of signals with the same signature indexed by an enum.
+	 All the connections of all the keys live in one contiguous buffer, sorted by key, and an offset table
+	 tells where the connections of every key begin. Emitting is O(1) to find the range of a key and
+	 the whole table needs one allocation instead of one per signal.
+
+	 By default the number of keys is taken from the 'Count' enumerator of TEnum.
+	 Connections of a table can't be disconnected through CConnection::Disconnect, use the table instead.
+	 */
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	class CSignalTable<TEnum, ReturnType(Args...), KeyCount>
+	{
+		//---------------------------------------------------------------------
+		// Type definitions
+		//---------------------------------------------------------------------
+	public:
+		using TConnection = CConnection<ReturnType(Args...)>;
+		using TSignal = CSignal<ReturnType(Args...)>;
+		using TBinding = CSignalBinding<TSignal>;
+		using TSignalTable = CSignalTable<TEnum, ReturnType(Args...), KeyCount>;
+
+		//---------------------------------------------------------------------
+		// Getters / Setters
+		//---------------------------------------------------------------------
+	public:
+		const bool		IsEmpty() const				{ return m_connections.empty(); }
+
+		const bool		IsEmpty(const TEnum key) const	{ return Count(key) == 0; }
+
+		const unsigned	Count() const				{ return m_connections.size(); }
+
+		const unsigned	Count(const TEnum key) const	{ return End(key) - Begin(key); }
+
+		//---------------------------------------------------------------------
+		// Constructors / Destructors
+		//---------------------------------------------------------------------
+	public:
+		CSignalTable();
+
+		~CSignalTable() { Clear(); delete mp_binding; }
+
+		CSignalTable(CSignalTable&& other) noexcept : TSignalTable() { swap(*this, other); }
+
+		TSignalTable& operator= (TSignalTable&& other) noexcept { swap(*this, other); return *this; }
+
+	private:
+		CSignalTable(const TSignalTable& copy) = delete;
+		TSignalTable& operator= (const TSignalTable& copy) = delete;
+
+		friend void swap(TSignalTable& first, TSignalTable& second) noexcept
+		{
+			using std::swap;
+			swap(first.m_connections, second.m_connections);
+			swap(first.m_offsets, second.m_offsets);
+			swap(first.mp_binding, second.mp_binding);
+		}
+
+		//---------------------------------------------------------------------
+		// Functions
+		//---------------------------------------------------------------------
+	public:
+		template <typename T>
+		TConnection& Connect(const TEnum key, const T& slotRef);
+
+		template <typename T>
+		TConnection& Connect(const TEnum key, const T* slotPtr);
+
+		template<typename T>
+		TConnection& Connect(const TEnum key, T* caller, ReturnType(T::* function) (Args...));
+
+		template<typename T>
+		TConnection& Connect(const TEnum key, const T* caller, ReturnType(T::* function) (Args...) const);
+
+		template<typename T>
+		void Disconnect(const TEnum key, const T& slotRef);
+
+		template<typename T>
+		void Disconnect(const TEnum key, const T* slotPtr);
+
+		template<typename T>
+		void Disconnect(const TEnum key, T* caller, ReturnType(T::* function) (Args...));
+
+		template<typename T>
+		void Disconnect(const TEnum key, const T* caller, ReturnType(T::* function) (Args...) const);
+
+		void Disconnect(const TEnum key, const TConnection& connection);
+
+		void Clear(const TEnum key);
+
+		void Clear();
+
+		const bool operator() (const TEnum key, Args... args) const;
+
+		template<typename TArray>
+		const bool operator() (const TEnum key, TArray& valuesArray, Args... args) const;
+
+	private:
+		static const unsigned Index(const TEnum key);
+
+		const unsigned Begin(const TEnum key) const { return m_offsets[Index(key)]; }
+
+		const unsigned End(const TEnum key) const { return m_offsets[Index(key) + 1]; }
+
+		TBinding* Binding();
+
+		// Inserts the connection at the end of the range of the key
+		TConnection& Insert(const TEnum key, TConnection&& connection);
+
+		// Removes the connection at the given index, which belongs to the range of the key
+		void Erase(const TEnum key, const unsigned index);
+
+	private:
+		std::vector<TConnection> m_connections;
+
+		// m_offsets[k] is the first connection of the key k, m_offsets[KeyCount] is the total
+		unsigned m_offsets[KeyCount + 1];
+
+		// Only used to identify the connections of this table, its signal is always null
+		TBinding* mp_binding;
+	};
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	CSignalTable<TEnum, ReturnType(Args...), KeyCount>::CSignalTable() : mp_binding(0)
+	{
+		std::fill(m_offsets, m_offsets + KeyCount + 1, 0u);
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Connect(const TEnum key, const T& slotRef)
+	{
+		return Insert(key, TConnection(Binding(), const_cast<T&>(slotRef)));
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template <typename T>
+	CConnection<ReturnType(Args...)>& CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Connect(const TEnum key, const T* slotPtr)
+	{
+		return Insert(key, TConnection(Binding(), const_cast<T*>(slotPtr)));
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Connect(const TEnum key, T* caller, ReturnType(T::* function) (Args...))
+	{
+		return Insert(key, TConnection(Binding(), caller, function));
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	CConnection<ReturnType(Args...)>& CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Connect(const TEnum key, const T* caller, ReturnType(T::* function) (Args...) const)
+	{
+		// Since we know that the member function is const, it's safe to
+		// remove the const qualifier from the 'caller' pointer with a const_cast.
+		return Insert(key, TConnection(Binding(), const_cast<T*>(caller), function));
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Disconnect(const TEnum key, const T& ref)
+	{
+		T& nonConstRef = const_cast<T&>(ref);
+		for (unsigned i = Begin(key), end = End(key); i < end; ++i)
+		{
+			if (m_connections[i].Equals(nonConstRef))
+			{
+				Erase(key, i);
+				return;
+			}
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Disconnect(const TEnum key, const T* ptr)
+	{
+		T* nonConstPtr = const_cast<T*>(ptr);
+		for (unsigned i = Begin(key), end = End(key); i < end; ++i)
+		{
+			if (m_connections[i].Equals(nonConstPtr))
+			{
+				Erase(key, i);
+				return;
+			}
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Disconnect(const TEnum key, T* ptr, ReturnType(T::* function) (Args...))
+	{
+		for (unsigned i = Begin(key), end = End(key); i < end; ++i)
+		{
+			if (m_connections[i].Equals(ptr, function))
+			{
+				Erase(key, i);
+				return;
+			}
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename T>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Disconnect(const TEnum key, const T* ptr, ReturnType(T::* function) (Args...) const)
+	{
+		T* nonConstPtr = const_cast<T*>(ptr);
+		for (unsigned i = Begin(key), end = End(key); i < end; ++i)
+		{
+			if (m_connections[i].Equals(nonConstPtr, function))
+			{
+				Erase(key, i);
+				return;
+			}
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Disconnect(const TEnum key, const TConnection& connection)
+	{
+		for (unsigned i = Begin(key), end = End(key); i < end; ++i)
+		{
+			if (m_connections[i] == connection)
+			{
+				Erase(key, i);
+				return;
+			}
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Clear(const TEnum key)
+	{
+		const unsigned begin = Begin(key);
+		const unsigned count = End(key) - begin;
+
+		m_connections.erase(m_connections.begin() + begin, m_connections.begin() + begin + count);
+		for (unsigned k = Index(key) + 1; k <= KeyCount; ++k)
+		{
+			m_offsets[k] -= count;
+		}
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Clear()
+	{
+		m_connections.clear();
+		std::fill(m_offsets, m_offsets + KeyCount + 1, 0u);
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	const bool CSignalTable<TEnum, ReturnType(Args...), KeyCount>::operator() (const TEnum key, Args... args) const
+	{
+		// The connections made by the slots are not part of this emission, but they move the connections
+		// of the key, so they are looked up again every time
+		const unsigned count = End(key) - Begin(key);
+		for (unsigned i = 0; i < count && Begin(key) + i < End(key); ++i)
+		{
+			m_connections[Begin(key) + i](args...);
+		}
+		return true;
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	template<typename TArray>
+	const bool CSignalTable<TEnum, ReturnType(Args...), KeyCount>::operator() (const TEnum key, TArray& valuesArray, Args... args) const
+	{
+		const unsigned count = End(key) - Begin(key);
+		for (unsigned i = 0; i < count && Begin(key) + i < End(key); ++i)
+		{
+			valuesArray[i] = m_connections[Begin(key) + i](args...);
+		}
+		return true;
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	inline const unsigned CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Index(const TEnum key)
+	{
+		const unsigned index = static_cast<unsigned>(key);
+		assert(index < KeyCount && "Key out of the range of the table");
+		return index;
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	CSignalBinding<CSignal<ReturnType(Args...)>>* CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Binding()
+	{
+		if (!mp_binding)
+		{
+			mp_binding = new TBinding(0);
+		}
+		return mp_binding;
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	CConnection<ReturnType(Args...)>& CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Insert(const TEnum key, TConnection&& connection)
+	{
+		const unsigned index = End(key);
+		const auto& it = m_connections.insert(m_connections.begin() + index, std::move(connection));
+
+		for (unsigned k = Index(key) + 1; k <= KeyCount; ++k)
+		{
+			++m_offsets[k];
+		}
+		return *it;
+	}
+
+	template<typename TEnum, unsigned KeyCount, typename ReturnType, typename... Args>
+	void CSignalTable<TEnum, ReturnType(Args...), KeyCount>::Erase(const TEnum key, const unsigned index)
+	{
+		m_connections.erase(m_connections.begin() + index);
+
+		for (unsigned k = Index(key) + 1; k <= KeyCount; ++k)
+		{
+			--m_offsets[k];
+		}
+	}
+}
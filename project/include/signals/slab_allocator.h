@@ -0,0 +1,234 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * slab_allocator.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <new>
+#include <mutex>
+#include <cstddef>
+
+namespace dc
+{
+	/*
+	 CSLABALLOCATOR
+
+	 Size-class allocator shared by every signal for the connection-related allocations (bindings,
+	 owned callables). Blocks are carved from slabs of kSlabSize bytes, so the nodes of all the
+	 connections stay packed together, and every thread keeps its own free list per size class:
+	 allocating and freeing are a couple of pointer moves without locks.
+
+	 A block freed by another thread goes to the free list of that thread. When a thread finishes, its
+	 free blocks go to a shared depot, the only place guarded by a mutex. Slabs are never released.
+	 The blocks freed after the cache of the thread is destroyed, like the ones of the static signals
+	 destroyed after the main thread cache, go straight to the depot.
+	 Sizes over kMaxBlockSize are served by the global operator new.
+	 */
+	class CSlabAllocator
+	{
+	public:
+		static const std::size_t kGranularity = 16;
+		static const std::size_t kMaxBlockSize = 256;
+		static const std::size_t kClassCount = kMaxBlockSize / kGranularity;
+		static const std::size_t kSlabSize = 16 * 1024;
+
+	private:
+		struct SFreeBlock
+		{
+			SFreeBlock* mp_next;
+		};
+
+		// Free blocks of one thread
+		class CThreadCache
+		{
+		public:
+			CThreadCache();
+			~CThreadCache();
+
+		public:
+			SFreeBlock* m_freeLists[kClassCount];
+		};
+
+		// Free blocks left by the threads that finished
+		struct SDepot
+		{
+			SDepot();
+
+			std::mutex	m_mutex;
+			SFreeBlock*	m_freeLists[kClassCount];
+		};
+
+	public:
+		static void* Allocate(const std::size_t size);
+
+		static void Deallocate(void* memory, const std::size_t size);
+
+	private:
+		static const std::size_t SizeClass(const std::size_t size) { return (size + kGranularity - 1) / kGranularity - 1; }
+
+		static CThreadCache& ThreadCache()
+		{
+			static thread_local CThreadCache cache;
+			return cache;
+		}
+
+		// Trivially destructible, so it can still be read once the cache of the thread is destroyed
+		static bool& IsThreadCacheDestroyed()
+		{
+			static thread_local bool isDestroyed = false;
+			return isDestroyed;
+		}
+
+		static SDepot& Depot()
+		{
+			// Never destroyed, the thread caches can finish after the static objects
+			static SDepot* depot = new SDepot();
+			return *depot;
+		}
+
+		static SFreeBlock* Refill(const std::size_t sizeClass);
+
+		// Allocation through the depot, for the threads without cache
+		static void* AllocateShared(const std::size_t sizeClass);
+
+		// Moves a list of free blocks to the depot
+		static void Release(SFreeBlock* blocks, const std::size_t sizeClass);
+	};
+
+	inline void* CSlabAllocator::Allocate(const std::size_t size)
+	{
+		if (size == 0 || size > kMaxBlockSize) return ::operator new(size);
+
+		const std::size_t sizeClass = SizeClass(size);
+		if (IsThreadCacheDestroyed()) return AllocateShared(sizeClass);
+
+		SFreeBlock*& freeList = ThreadCache().m_freeLists[sizeClass];
+		if (!freeList)
+		{
+			freeList = Refill(sizeClass);
+		}
+
+		SFreeBlock* block = freeList;
+		freeList = block->mp_next;
+		return block;
+	}
+
+	inline void CSlabAllocator::Deallocate(void* memory, const std::size_t size)
+	{
+		if (!memory) return;
+
+		if (size == 0 || size > kMaxBlockSize)
+		{
+			::operator delete(memory);
+			return;
+		}
+
+		SFreeBlock* block = static_cast<SFreeBlock*>(memory);
+		if (IsThreadCacheDestroyed())
+		{
+			block->mp_next = 0;
+			Release(block, SizeClass(size));
+			return;
+		}
+
+		SFreeBlock*& freeList = ThreadCache().m_freeLists[SizeClass(size)];
+		block->mp_next = freeList;
+		freeList = block;
+	}
+
+	inline CSlabAllocator::SFreeBlock* CSlabAllocator::Refill(const std::size_t sizeClass)
+	{
+		// Reusing the blocks of the finished threads first
+		{
+			SDepot& depot = Depot();
+			std::lock_guard<std::mutex> lock(depot.m_mutex);
+			if (SFreeBlock* blocks = depot.m_freeLists[sizeClass])
+			{
+				depot.m_freeLists[sizeClass] = 0;
+				return blocks;
+			}
+		}
+
+		const std::size_t blockSize = (sizeClass + 1) * kGranularity;
+		const std::size_t blockCount = kSlabSize / blockSize;
+		char* slab = static_cast<char*>(::operator new(kSlabSize));
+
+		SFreeBlock* blocks = 0;
+		for (std::size_t i = blockCount; i > 0; --i)
+		{
+			SFreeBlock* block = reinterpret_cast<SFreeBlock*>(slab + (i - 1) * blockSize);
+			block->mp_next = blocks;
+			blocks = block;
+		}
+		return blocks;
+	}
+
+	inline void* CSlabAllocator::AllocateShared(const std::size_t sizeClass)
+	{
+		SFreeBlock* block = Refill(sizeClass);
+
+		// The rest of the blocks are left in the depot
+		if (block->mp_next)
+		{
+			Release(block->mp_next, sizeClass);
+		}
+		return block;
+	}
+
+	inline void CSlabAllocator::Release(SFreeBlock* blocks, const std::size_t sizeClass)
+	{
+		SFreeBlock* last = blocks;
+		while (last->mp_next)
+		{
+			last = last->mp_next;
+		}
+
+		SDepot& depot = Depot();
+		std::lock_guard<std::mutex> lock(depot.m_mutex);
+		last->mp_next = depot.m_freeLists[sizeClass];
+		depot.m_freeLists[sizeClass] = blocks;
+	}
+
+	inline CSlabAllocator::CThreadCache::CThreadCache()
+	{
+		for (SFreeBlock*& freeList : m_freeLists)
+		{
+			freeList = 0;
+		}
+	}
+
+	inline CSlabAllocator::CThreadCache::~CThreadCache()
+	{
+		IsThreadCacheDestroyed() = true;
+		for (std::size_t sizeClass = 0; sizeClass < kClassCount; ++sizeClass)
+		{
+			if (!m_freeLists[sizeClass]) continue;
+
+			Release(m_freeLists[sizeClass], sizeClass);
+			m_freeLists[sizeClass] = 0;
+		}
+	}
+
+	inline CSlabAllocator::SDepot::SDepot()
+	{
+		for (SFreeBlock*& freeList : m_freeLists)
+		{
+			freeList = 0;
+		}
+	}
+}
@@ -0,0 +1,240 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * spsc_channel.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <limits.h>
+#include <new>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "signal.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	template<typename TSignature>
+	class CSpscChannel;
+
+	/*
+	 CSPSCCHANNEL
+
+	 Channel from a producer thread to a consumer thread that owns a signal. The producer pushes the arguments
+	 into a power-of-two ring and the consumer drains them into the connections of the signal. With a single
+	 thread on each side there are no locks nor compare-and-swap: each side writes its own index and keeps a
+	 copy of the other one, only reloaded when the ring looks full or empty. The indices are padded apart so
+	 the two threads don't share cache lines. The consumer releases the slots drained every kReleaseInterval
+	 emissions, so a producer waiting for room doesn't wait for the whole batch.
+	 When a slot throws, the drain stops there: the arguments already emitted, and the ones of the emission
+	 that threw, are released and the exception propagates, the rest are emitted by the next drain.
+
+	 Exactly one thread may push and one thread may drain, they can't change while the channel is in use.
+	 */
+	template<typename... Args>
+	class CSpscChannel<void(Args...)>
+	{
+	public:
+		using TSignal = CSignal<void(Args...)>;
+		using TConnection = typename TSignal::TConnection;
+
+	private:
+		using TArguments = std::tuple<typename std::decay<Args>::type...>;
+		using TIndices = typename detail::TMakeIndexSequence<sizeof...(Args)>::TType;
+		using TSlot = typename std::aligned_storage<sizeof(TArguments), alignof(TArguments)>::type;
+
+		static const std::size_t kCacheLineSize = 64;
+
+		// Emissions drained between the releases of their slots to the producer, a power of two
+		static const std::size_t kReleaseInterval = 64;
+
+	public:
+		explicit CSpscChannel(const unsigned capacity = 1024);
+
+		~CSpscChannel();
+
+	private:
+		CSpscChannel(const CSpscChannel& copy) = delete;
+		CSpscChannel& operator= (const CSpscChannel& copy) = delete;
+
+	public:
+		template<typename... TSlotArgs>
+		TConnection& Connect(TSlotArgs&&... slot) { return m_signal.Connect(std::forward<TSlotArgs>(slot)...); }
+
+		template<typename T>
+		TConnection& ConnectOwned(T&& callable) { return m_signal.ConnectOwned(std::forward<T>(callable)); }
+
+		template<typename... TSlotArgs>
+		void Disconnect(TSlotArgs&&... slot) { m_signal.Disconnect(std::forward<TSlotArgs>(slot)...); }
+
+		TSignal& Signal() { return m_signal; }
+
+		const unsigned Capacity() const { return m_mask + 1; }
+
+		//---------------------------------------------------------------------
+		// Producer
+		//---------------------------------------------------------------------
+		// Returns false, without pushing, when the ring is full
+		template<typename... TValues>
+		const bool TryPush(TValues&&... values);
+
+		// Yields until there's room in the ring
+		template<typename... TValues>
+		void Push(TValues&&... values);
+
+		//---------------------------------------------------------------------
+		// Consumer
+		//---------------------------------------------------------------------
+		// Emits up to maxCount of the arguments pushed, returns how many
+		const unsigned Drain(const unsigned maxCount = UINT_MAX);
+
+	private:
+		TArguments& Slot(const std::size_t index) { return *reinterpret_cast<TArguments*>(&mp_slots[index & m_mask]); }
+
+		template<unsigned... Indices>
+		void Emit(TArguments& arguments, detail::TIndexSequence<Indices...>)
+		{
+			m_signal(std::move(std::get<Indices>(arguments))...);
+		}
+
+		// Destroys the arguments of a slot once emitted, even when a connection throws
+		struct SDrainedSlot
+		{
+			explicit SDrainedSlot(TArguments& arguments) : m_arguments(arguments) {}
+			~SDrainedSlot() { m_arguments.~TArguments(); }
+
+			TArguments&	m_arguments;
+		};
+
+		// Releases the slots drained to the producer when the drain ends, even when a connection throws
+		struct SDrainedHead
+		{
+			SDrainedHead(std::atomic<std::size_t>& head, const std::size_t index) : m_head(head), m_index(index) {}
+			~SDrainedHead() { m_head.store(m_index, std::memory_order_release); }
+
+			std::atomic<std::size_t>&	m_head;
+			std::size_t					m_index;
+		};
+
+	private:
+		// Shared and read-only while in use
+		TSignal						m_signal;
+		std::unique_ptr<TSlot[]>	mp_slots;
+		std::size_t					m_mask;
+		char						m_sharedPadding[kCacheLineSize];
+
+		// Producer
+		std::atomic<std::size_t>	m_tail;
+		std::size_t					m_cachedHead;
+		char						m_producerPadding[kCacheLineSize];
+
+		// Consumer
+		std::atomic<std::size_t>	m_head;
+		std::size_t					m_cachedTail;
+		char						m_consumerPadding[kCacheLineSize];
+	};
+
+	template<typename... Args>
+	CSpscChannel<void(Args...)>::CSpscChannel(const unsigned capacity) :
+		m_mask(0),
+		m_tail(0),
+		m_cachedHead(0),
+		m_head(0),
+		m_cachedTail(0)
+	{
+		std::size_t slotCount = 1;
+		while (slotCount < capacity) slotCount <<= 1;
+
+		mp_slots.reset(new TSlot[slotCount]);
+		m_mask = slotCount - 1;
+	}
+
+	template<typename... Args>
+	CSpscChannel<void(Args...)>::~CSpscChannel()
+	{
+		const std::size_t tail = m_tail.load(std::memory_order_acquire);
+		for (std::size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+		{
+			Slot(head).~TArguments();
+		}
+	}
+
+	template<typename... Args>
+	template<typename... TValues>
+	const bool CSpscChannel<void(Args...)>::TryPush(TValues&&... values)
+	{
+		static_assert(sizeof...(TValues) == sizeof...(Args), "There must be a value for every argument");
+
+		const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead > m_mask)
+		{
+			// Looks full, refreshing the position of the consumer
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead > m_mask) return false;
+		}
+
+		new (&Slot(tail)) TArguments(std::forward<TValues>(values)...);
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename... Args>
+	template<typename... TValues>
+	void CSpscChannel<void(Args...)>::Push(TValues&&... values)
+	{
+		// The values are only moved when there's room
+		while (!TryPush(std::forward<TValues>(values)...))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	template<typename... Args>
+	const unsigned CSpscChannel<void(Args...)>::Drain(const unsigned maxCount)
+	{
+		std::size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail)
+		{
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail) return 0;
+		}
+
+		const std::size_t available = m_cachedTail - head;
+		const std::size_t count = available < maxCount ? available : maxCount;
+		SDrainedHead drained(m_head, head);
+		for (const std::size_t end = head + count; drained.m_index != end;)
+		{
+			{
+				SDrainedSlot slot(Slot(drained.m_index++));
+				Emit(slot.m_arguments, TIndices());
+			}
+
+			// Releasing the slots as the batch goes, the rest when it ends
+			if ((drained.m_index & (kReleaseInterval - 1)) == 0)
+			{
+				m_head.store(drained.m_index, std::memory_order_release);
+			}
+		}
+		return count;
+	}
+}
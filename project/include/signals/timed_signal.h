@@ -0,0 +1,462 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * timed_signal.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+#include "signal.h"
+#include "timing_wheel.h"
+#include "slab_allocator.h"
+#include "index_sequence.h"
+
+namespace dc
+{
+	namespace detail
+	{
+		/*
+		 Signal emitted later from the expiration of timers. Keeps the signal, the wheel and the connection
+		 functions shared by the timed signals.
+		 */
+		template<typename TSignature>
+		class CTimedSignal;
+
+		template<typename ReturnType, typename... Args>
+		class CTimedSignal<ReturnType(Args...)>
+		{
+			static_assert(TAreCopyable<Args...>::value, "The arguments must be copyable to emit them later");
+
+		public:
+			using TSignal = CSignal<ReturnType(Args...)>;
+			using TConnection = typename TSignal::TConnection;
+			using TDuration = CTimingWheel::TDuration;
+
+		protected:
+			using TArguments = std::tuple<typename std::decay<Args>::type...>;
+			using TIndices = typename TMakeIndexSequence<sizeof...(Args)>::TType;
+
+		protected:
+			explicit CTimedSignal(CTimingWheel& wheel) : mp_timingWheel(&wheel) {}
+
+		private:
+			CTimedSignal(const CTimedSignal& copy) = delete;
+			CTimedSignal& operator= (const CTimedSignal& copy) = delete;
+
+		public:
+			template<typename... TSlot>
+			TConnection& Connect(TSlot&&... slot) { return m_signal.Connect(std::forward<TSlot>(slot)...); }
+
+			template<typename T>
+			TConnection& ConnectOwned(T&& callable) { return m_signal.ConnectOwned(std::forward<T>(callable)); }
+
+			template<typename... TSlot>
+			void Disconnect(TSlot&&... slot) { m_signal.Disconnect(std::forward<TSlot>(slot)...); }
+
+			const unsigned Count() const { return m_signal.Count(); }
+
+			TSignal& Signal() { return m_signal; }
+
+		protected:
+			// Emits the arguments moved, they are taken out of their storage before in case it's released by a slot
+			template<unsigned... Indices>
+			void Emit(TArguments& arguments, TIndexSequence<Indices...>)
+			{
+				m_signal(std::move(std::get<Indices>(arguments))...);
+			}
+
+		protected:
+			TSignal			m_signal;
+			CTimingWheel*	mp_timingWheel;
+		};
+
+		// Storage for the arguments of an emission still to come, reused without allocating
+		template<typename TArguments>
+		class CPendingArguments
+		{
+		public:
+			CPendingArguments() : m_isStored(false) {}
+
+			~CPendingArguments() { Reset(); }
+
+		public:
+			template<typename... TValues>
+			void Store(TValues&&... values)
+			{
+				if (m_isStored)
+				{
+					Get() = std::forward_as_tuple(std::forward<TValues>(values)...);
+					return;
+				}
+				new (&m_storage) TArguments(std::forward<TValues>(values)...);
+				m_isStored = true;
+			}
+
+			// Moves the arguments out, leaving the storage empty
+			TArguments Take()
+			{
+				TArguments arguments(std::move(Get()));
+				Reset();
+				return arguments;
+			}
+
+			void Reset()
+			{
+				if (!m_isStored) return;
+
+				Get().~TArguments();
+				m_isStored = false;
+			}
+
+			const bool IsStored() const { return m_isStored; }
+
+		private:
+			TArguments& Get() { return *reinterpret_cast<TArguments*>(&m_storage); }
+
+		private:
+			typename std::aligned_storage<sizeof(TArguments), alignof(TArguments)>::type	m_storage;
+			bool																		m_isStored;
+		};
+	}
+
+	template<typename TSignature>
+	class CDelayedSignal;
+
+	/*
+	 CDELAYEDSIGNAL
+
+	 Signal whose emissions happen after a delay, when the timing wheel expires them. Every pending emission
+	 keeps a copy of its arguments in a node of the slab allocator with its own timer, so thousands of them
+	 can be scheduled and cancelled in constant time. The pending emissions are cancelled with the signal.
+	 They are identified by handles with the generation of their slot, so a handle kept after its emission
+	 happened or was cancelled is just stale, and cancelling it does nothing.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CDelayedSignal<ReturnType(Args...)> : public detail::CTimedSignal<ReturnType(Args...)>
+	{
+		using TBase = detail::CTimedSignal<ReturnType(Args...)>;
+		using typename TBase::TArguments;
+		using typename TBase::TIndices;
+
+	public:
+		using typename TBase::TDuration;
+
+		struct SEmissionHandle
+		{
+			SEmissionHandle() : m_slot(kNoSlot), m_generation(0) {}
+			SEmissionHandle(const unsigned slot, const unsigned generation) : m_slot(slot), m_generation(generation) {}
+
+			unsigned	m_slot;
+			unsigned	m_generation;
+		};
+
+	private:
+		static const unsigned kNoSlot = ~0u;
+
+		class CEmission : private CTimer
+		{
+			friend class CDelayedSignal;
+
+		public:
+			static void* operator new(const std::size_t size) { return CSlabAllocator::Allocate(size); }
+
+			static void operator delete(void* pointer, const std::size_t size) { CSlabAllocator::Deallocate(pointer, size); }
+
+		private:
+			template<typename... TValues>
+			CEmission(CDelayedSignal* owner, const unsigned slot, TValues&&... values) :
+				CTimer(&CDelayedSignal::Expire),
+				mp_owner(owner),
+				m_slot(slot),
+				m_arguments(std::forward<TValues>(values)...)
+			{}
+
+		private:
+			CDelayedSignal*	mp_owner;
+			unsigned		m_slot;
+			TArguments		m_arguments;
+		};
+
+		// The slots are reused through a free list, their generation tells the handles of every use apart
+		struct SEmissionSlot
+		{
+			CEmission*	mp_emission;
+			unsigned	m_generation;
+			unsigned	m_nextFree;
+		};
+
+	public:
+		explicit CDelayedSignal(CTimingWheel& wheel) : TBase(wheel), m_freeSlot(kNoSlot), m_pendingCount(0) {}
+
+		~CDelayedSignal() { CancelAll(); }
+
+	public:
+		// The emission can be cancelled through the handle until the wheel emits it
+		SEmissionHandle EmitAfter(const TDuration delay, Args... args);
+
+		// Returns false if the emission already happened or was cancelled
+		const bool Cancel(const SEmissionHandle& handle);
+
+		void CancelAll();
+
+		const bool IsPending(const SEmissionHandle& handle) const { return Find(handle) != 0; }
+
+		const unsigned PendingCount() const { return m_pendingCount; }
+
+	private:
+		static void Expire(CTimer& timer);
+
+		CEmission* Find(const SEmissionHandle& handle) const;
+
+		void Release(CEmission& emission);
+
+	private:
+		std::vector<SEmissionSlot>	m_slots;
+		unsigned					m_freeSlot;
+		unsigned					m_pendingCount;
+	};
+
+	template<typename ReturnType, typename... Args>
+	typename CDelayedSignal<ReturnType(Args...)>::SEmissionHandle CDelayedSignal<ReturnType(Args...)>::EmitAfter(const TDuration delay, Args... args)
+	{
+		unsigned slot = m_freeSlot;
+		if (slot == kNoSlot)
+		{
+			slot = m_slots.size();
+			m_slots.push_back(SEmissionSlot{ 0, 0, kNoSlot });
+		}
+		else
+		{
+			m_freeSlot = m_slots[slot].m_nextFree;
+		}
+
+		CEmission* emission = new CEmission(this, slot, std::forward<Args>(args)...);
+		m_slots[slot].mp_emission = emission;
+		++m_pendingCount;
+
+		this->mp_timingWheel->Schedule(*emission, delay);
+		return SEmissionHandle(slot, m_slots[slot].m_generation);
+	}
+
+	template<typename ReturnType, typename... Args>
+	const bool CDelayedSignal<ReturnType(Args...)>::Cancel(const SEmissionHandle& handle)
+	{
+		CEmission* emission = Find(handle);
+		if (!emission) return false;
+
+		Release(*emission);
+		return true;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CDelayedSignal<ReturnType(Args...)>::CancelAll()
+	{
+		for (const SEmissionSlot& slot : m_slots)
+		{
+			if (slot.mp_emission)
+			{
+				Release(*slot.mp_emission);
+			}
+		}
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CDelayedSignal<ReturnType(Args...)>::Expire(CTimer& timer)
+	{
+		CEmission& emission = static_cast<CEmission&>(timer);
+		CDelayedSignal* owner = emission.mp_owner;
+
+		TArguments arguments(std::move(emission.m_arguments));
+		owner->Release(emission);
+		owner->Emit(arguments, TIndices());
+	}
+
+	template<typename ReturnType, typename... Args>
+	typename CDelayedSignal<ReturnType(Args...)>::CEmission* CDelayedSignal<ReturnType(Args...)>::Find(const SEmissionHandle& handle) const
+	{
+		if (handle.m_slot >= m_slots.size()) return 0;
+
+		const SEmissionSlot& slot = m_slots[handle.m_slot];
+		return slot.m_generation == handle.m_generation ? slot.mp_emission : 0;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CDelayedSignal<ReturnType(Args...)>::Release(CEmission& emission)
+	{
+		SEmissionSlot& slot = m_slots[emission.m_slot];
+		slot.mp_emission = 0;
+		++slot.m_generation;
+		slot.m_nextFree = m_freeSlot;
+		m_freeSlot = emission.m_slot;
+		--m_pendingCount;
+
+		// The timer cancels itself when destroyed
+		delete &emission;
+	}
+
+	template<typename TSignature>
+	class CDebouncedSignal;
+
+	/*
+	 CDEBOUNCEDSIGNAL
+
+	 Signal emitted once its emissions stop for a quiet period, with the arguments of the last one. Every
+	 emission reschedules the same timer and overwrites the same arguments, nothing is allocated.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CDebouncedSignal<ReturnType(Args...)> : public detail::CTimedSignal<ReturnType(Args...)>, private CTimer
+	{
+		using TBase = detail::CTimedSignal<ReturnType(Args...)>;
+		using typename TBase::TArguments;
+		using typename TBase::TIndices;
+
+	public:
+		using typename TBase::TDuration;
+
+	public:
+		CDebouncedSignal(CTimingWheel& wheel, const TDuration quietPeriod) :
+			TBase(wheel),
+			CTimer(&CDebouncedSignal::Expire),
+			m_quietPeriod(quietPeriod)
+		{}
+
+	public:
+		void operator() (Args... args);
+
+		// Drops the emission waiting for the quiet period
+		void Cancel();
+
+		const bool IsPending() const { return CTimer::IsPending(); }
+
+	private:
+		static void Expire(CTimer& timer);
+
+	private:
+		detail::CPendingArguments<TArguments>	m_pending;
+		TDuration								m_quietPeriod;
+	};
+
+	template<typename ReturnType, typename... Args>
+	void CDebouncedSignal<ReturnType(Args...)>::operator() (Args... args)
+	{
+		m_pending.Store(std::forward<Args>(args)...);
+		this->mp_timingWheel->Schedule(*this, m_quietPeriod);
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CDebouncedSignal<ReturnType(Args...)>::Cancel()
+	{
+		CTimer::Cancel();
+		m_pending.Reset();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CDebouncedSignal<ReturnType(Args...)>::Expire(CTimer& timer)
+	{
+		CDebouncedSignal& signal = static_cast<CDebouncedSignal&>(timer);
+		TArguments arguments(signal.m_pending.Take());
+		signal.Emit(arguments, TIndices());
+	}
+
+	template<typename TSignature>
+	class CThrottledSignal;
+
+	/*
+	 CTHROTTLEDSIGNAL
+
+	 Signal emitted at most once per interval. The first emission goes through at once and opens the interval,
+	 the ones inside it are collapsed into a single emission with the last arguments at its end, which opens
+	 the next interval.
+	 */
+	template<typename ReturnType, typename... Args>
+	class CThrottledSignal<ReturnType(Args...)> : public detail::CTimedSignal<ReturnType(Args...)>, private CTimer
+	{
+		using TBase = detail::CTimedSignal<ReturnType(Args...)>;
+		using typename TBase::TArguments;
+		using typename TBase::TIndices;
+		using TTimePoint = CTimingWheel::TTimePoint;
+
+	public:
+		using typename TBase::TDuration;
+
+	public:
+		CThrottledSignal(CTimingWheel& wheel, const TDuration interval) :
+			TBase(wheel),
+			CTimer(&CThrottledSignal::Expire),
+			m_interval(interval),
+			m_intervalEnd(TTimePoint::min())
+		{}
+
+	public:
+		// Returns true if the signal was emitted at once
+		const bool operator() (Args... args);
+
+		// Drops the emission waiting for the end of the interval
+		void Cancel();
+
+		const bool IsPending() const { return CTimer::IsPending(); }
+
+	private:
+		static void Expire(CTimer& timer);
+
+	private:
+		detail::CPendingArguments<TArguments>	m_pending;
+		TDuration								m_interval;
+		TTimePoint								m_intervalEnd;
+	};
+
+	template<typename ReturnType, typename... Args>
+	const bool CThrottledSignal<ReturnType(Args...)>::operator() (Args... args)
+	{
+		const TTimePoint now = this->mp_timingWheel->Now();
+		if (!CTimer::IsPending() && now >= m_intervalEnd)
+		{
+			m_intervalEnd = now + m_interval;
+			this->m_signal(std::forward<Args>(args)...);
+			return true;
+		}
+
+		m_pending.Store(std::forward<Args>(args)...);
+		if (!CTimer::IsPending())
+		{
+			this->mp_timingWheel->Schedule(*this, m_intervalEnd - now);
+		}
+		return false;
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CThrottledSignal<ReturnType(Args...)>::Cancel()
+	{
+		CTimer::Cancel();
+		m_pending.Reset();
+	}
+
+	template<typename ReturnType, typename... Args>
+	void CThrottledSignal<ReturnType(Args...)>::Expire(CTimer& timer)
+	{
+		CThrottledSignal& signal = static_cast<CThrottledSignal&>(timer);
+		signal.m_intervalEnd = signal.mp_timingWheel->Now() + signal.m_interval;
+
+		TArguments arguments(signal.m_pending.Take());
+		signal.Emit(arguments, TIndices());
+	}
+}
@@ -0,0 +1,312 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * timing_wheel.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <chrono>
+#include <functional>
+
+namespace dc
+{
+	class CTimingWheel;
+
+	// Link of the intrusive lists of timers, the slots of the wheel are the heads of their lists
+	struct STimerLink
+	{
+		STimerLink() : mp_previous(this), mp_next(this) {}
+
+		STimerLink*	mp_previous;
+		STimerLink*	mp_next;
+	};
+
+	/*
+	 CTIMER
+
+	 Timer scheduled in a timing wheel. It isn't allocated by the wheel, it's embedded in the objects that need
+	 it, that pass the function invoked on expiration. A timer can be scheduled in a single wheel at a time.
+	 */
+	class CTimer : private STimerLink
+	{
+		friend class CTimingWheel;
+
+	public:
+		using TExpire = void (*)(CTimer& timer);
+
+	public:
+		explicit CTimer(TExpire expire) : mp_wheel(0), mp_expire(expire), m_expiry(0) {}
+
+		~CTimer() { Cancel(); }
+
+	private:
+		CTimer(const CTimer& copy) = delete;
+		CTimer& operator= (const CTimer& copy) = delete;
+
+	public:
+		const bool IsPending() const { return mp_wheel != 0; }
+
+		void Cancel();
+
+	private:
+		CTimingWheel*	mp_wheel;
+		TExpire			mp_expire;
+		uint64_t		m_expiry;
+	};
+
+	/*
+	 CTIMINGWHEEL
+
+	 Hierarchical timing wheel. Time advances in ticks of a fixed resolution and every level has 64 slots, each
+	 one spanning 64 slots of the level below, so four levels cover 64^4 ticks. Scheduling links the timer in
+	 the slot of its expiry and cancelling unlinks it, both in constant time whatever the number of timers.
+	 The timers of a slot of the upper levels are moved down when the level below wraps around.
+	 Delays longer than the wheel are kept in the last level and rescheduled until they expire.
+
+	 The wheel doesn't have a thread, its owner calls Update from its loop and the timers expire inside it.
+	 The clock can be replaced, for example by a manual one in the tests.
+	 */
+	class CTimingWheel
+	{
+	public:
+		using TClock = std::function<std::chrono::steady_clock::time_point()>;
+		using TTimePoint = std::chrono::steady_clock::time_point;
+		using TDuration = std::chrono::steady_clock::duration;
+
+	private:
+		static const unsigned kSlotBits = 6;
+		static const unsigned kSlotCount = 1 << kSlotBits;
+		static const unsigned kLevelCount = 4;
+		static const uint64_t kMaxDelay = (uint64_t(1) << (kSlotBits * kLevelCount)) - 1;
+
+	public:
+		explicit CTimingWheel(const TDuration resolution = std::chrono::milliseconds(1), TClock clock = &std::chrono::steady_clock::now);
+
+		~CTimingWheel();
+
+	private:
+		CTimingWheel(const CTimingWheel& copy) = delete;
+		CTimingWheel& operator= (const CTimingWheel& copy) = delete;
+
+	public:
+		// Schedules the timer to expire after the delay, rounded up to the resolution. Pending timers are rescheduled.
+		void Schedule(CTimer& timer, const TDuration delay);
+
+		void Cancel(CTimer& timer);
+
+		// Expires the timers due until now and returns how many
+		const unsigned Update();
+
+		TTimePoint Now() const { return m_clock(); }
+
+		const TDuration Resolution() const { return m_resolution; }
+
+		const unsigned PendingCount() const { return m_pendingCount; }
+
+	private:
+		const uint64_t TickAt(const TTimePoint time) const { return time > m_start ? (time - m_start) / m_resolution : 0; }
+
+		void Place(CTimer& timer);
+
+		// Moves the timers of a slot to the slots of their expiry from the current tick
+		void Cascade(const unsigned level, const unsigned index);
+
+		const unsigned Expire(STimerLink& timers);
+
+		// Moves all the timers of the slot to the list
+		static void Detach(STimerLink& slot, STimerLink& list);
+
+		static void Link(STimerLink& head, STimerLink& link);
+
+		static void Unlink(STimerLink& link);
+
+	private:
+		STimerLink	m_slots[kLevelCount][kSlotCount];
+		TDuration	m_resolution;
+		TClock		m_clock;
+		TTimePoint	m_start;
+		uint64_t	m_tick;
+		unsigned	m_pendingCount;
+	};
+
+	inline void CTimer::Cancel()
+	{
+		if (mp_wheel)
+		{
+			mp_wheel->Cancel(*this);
+		}
+	}
+
+	inline CTimingWheel::CTimingWheel(const TDuration resolution, TClock clock) :
+		m_resolution(resolution),
+		m_clock(std::move(clock)),
+		m_start(m_clock()),
+		m_tick(0),
+		m_pendingCount(0)
+	{
+		assert(resolution.count() > 0 && "The resolution of the wheel must be positive");
+	}
+
+	inline CTimingWheel::~CTimingWheel()
+	{
+		// Leaving the timers still pending as if they were cancelled
+		for (unsigned level = 0; level < kLevelCount; ++level)
+		{
+			for (unsigned index = 0; index < kSlotCount; ++index)
+			{
+				STimerLink& slot = m_slots[level][index];
+				while (slot.mp_next != &slot)
+				{
+					CTimer& timer = static_cast<CTimer&>(*slot.mp_next);
+					Unlink(timer);
+					timer.mp_wheel = 0;
+				}
+			}
+		}
+	}
+
+	inline void CTimingWheel::Schedule(CTimer& timer, const TDuration delay)
+	{
+		if (timer.mp_wheel)
+		{
+			timer.mp_wheel->Cancel(timer);
+		}
+
+		const uint64_t ticks = delay.count() > 0 ? (delay + m_resolution - TDuration(1)) / m_resolution : 0;
+		const uint64_t expiry = TickAt(Now()) + ticks;
+
+		// The first tick not yet processed is the earliest expiry
+		timer.m_expiry = expiry > m_tick ? expiry : m_tick;
+		timer.mp_wheel = this;
+		++m_pendingCount;
+		Place(timer);
+	}
+
+	inline void CTimingWheel::Cancel(CTimer& timer)
+	{
+		if (timer.mp_wheel != this) return;
+
+		Unlink(timer);
+		timer.mp_wheel = 0;
+		--m_pendingCount;
+	}
+
+	inline const unsigned CTimingWheel::Update()
+	{
+		const uint64_t now = TickAt(Now());
+		unsigned expired = 0;
+		while (m_tick <= now)
+		{
+			// Nothing to move nor expire, jumping to the present
+			if (m_pendingCount == 0)
+			{
+				m_tick = now + 1;
+				break;
+			}
+
+			const unsigned index = m_tick & (kSlotCount - 1);
+			for (unsigned level = 1; index == 0 && level < kLevelCount; ++level)
+			{
+				const unsigned levelIndex = (m_tick >> (kSlotBits * level)) & (kSlotCount - 1);
+				Cascade(level, levelIndex);
+				if (levelIndex != 0) break;
+			}
+
+			// The timers scheduled while expiring the slot go to the next ticks
+			STimerLink timers;
+			Detach(m_slots[0][index], timers);
+			++m_tick;
+			expired += Expire(timers);
+		}
+		return expired;
+	}
+
+	inline void CTimingWheel::Place(CTimer& timer)
+	{
+		uint64_t expiry = timer.m_expiry;
+		uint64_t delay = expiry - m_tick;
+		if (delay > kMaxDelay)
+		{
+			expiry = m_tick + kMaxDelay;
+			delay = kMaxDelay;
+		}
+
+		unsigned level = 0;
+		while (delay >= (uint64_t(1) << (kSlotBits * (level + 1))))
+		{
+			++level;
+		}
+		Link(m_slots[level][(expiry >> (kSlotBits * level)) & (kSlotCount - 1)], timer);
+	}
+
+	inline void CTimingWheel::Cascade(const unsigned level, const unsigned index)
+	{
+		// Taking the whole list, placing them again could link some back into the same slot
+		STimerLink pending;
+		Detach(m_slots[level][index], pending);
+
+		while (pending.mp_next != &pending)
+		{
+			CTimer& timer = static_cast<CTimer&>(*pending.mp_next);
+			Unlink(timer);
+			Place(timer);
+		}
+	}
+
+	inline const unsigned CTimingWheel::Expire(STimerLink& timers)
+	{
+		unsigned expired = 0;
+
+		// The expirations can schedule and cancel timers, even the ones still in the list
+		while (timers.mp_next != &timers)
+		{
+			CTimer& timer = static_cast<CTimer&>(*timers.mp_next);
+			Cancel(timer);
+			timer.mp_expire(timer);
+			++expired;
+		}
+		return expired;
+	}
+
+	inline void CTimingWheel::Detach(STimerLink& slot, STimerLink& list)
+	{
+		if (slot.mp_next == &slot) return;
+
+		list.mp_next = slot.mp_next;
+		list.mp_previous = slot.mp_previous;
+		list.mp_next->mp_previous = &list;
+		list.mp_previous->mp_next = &list;
+		slot.mp_next = slot.mp_previous = &slot;
+	}
+
+	inline void CTimingWheel::Link(STimerLink& head, STimerLink& link)
+	{
+		link.mp_previous = head.mp_previous;
+		link.mp_next = &head;
+		head.mp_previous->mp_next = &link;
+		head.mp_previous = &link;
+	}
+
+	inline void CTimingWheel::Unlink(STimerLink& link)
+	{
+		link.mp_previous->mp_next = link.mp_next;
+		link.mp_next->mp_previous = link.mp_previous;
+		link.mp_previous = link.mp_next = &link;
+	}
+}
@@ -0,0 +1,308 @@
+/*
+ The MIT License (MIT)
+ 
+ Copyright (c) 2016 Jorge López González
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * tracer.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: Jorge López González
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <stdio.h>
+
+/*
+ Tracing of the emissions is compiled only when DCPP_SIGNALS_TRACING is defined (CMake option
+ DCPPSIGNALS_TRACING). Even then nothing is recorded until CTracer::Start is called.
+ */
+#if defined(DCPP_SIGNALS_TRACING)
+	#define DCPP_SIGNALS_TRACE_EMIT(binding) dc::CTraceEmitScope traceEmit((binding) ? (binding)->mp_name : 0, (binding))
+	#define DCPP_SIGNALS_TRACE_SLOT(connection) dc::CTraceSlotScope traceSlot(connection)
+#else
+	#define DCPP_SIGNALS_TRACE_EMIT(binding) ((void)0)
+	#define DCPP_SIGNALS_TRACE_SLOT(connection) ((void)0)
+#endif
+
+namespace dc
+{
+	struct STraceEvent
+	{
+		enum EPhase { BEGIN, END };
+		enum EKind { EMIT, SLOT };
+
+		// Nanoseconds of the steady clock
+		long long		time;
+		const char*		mp_name;
+		const void*		mp_id;
+		const void*		mp_function;
+		unsigned char	phase;
+		unsigned char	kind;
+	};
+
+	/*
+	 CTRACEBUFFER
+
+	 Ring buffer of the events of one thread. Only its thread writes on it, so pushing is a store and an
+	 index increment; when it is full the oldest events are overwritten.
+	 */
+	class CTraceBuffer
+	{
+	public:
+		static const unsigned kCapacity = 1 << 15;
+
+	public:
+		explicit CTraceBuffer(const unsigned threadId) : m_threadId(threadId), m_head(0) {}
+
+	public:
+		void Push(const STraceEvent& event)
+		{
+			const unsigned long long head = m_head.load(std::memory_order_relaxed);
+			m_events[head & (kCapacity - 1)] = event;
+			m_head.store(head + 1, std::memory_order_release);
+		}
+
+	public:
+		const unsigned						m_threadId;
+		std::atomic<unsigned long long>		m_head;
+		STraceEvent							m_events[kCapacity];
+	};
+
+	/*
+	 CTRACER
+
+	 Records the begin and end of every emission and every slot call in a per-thread ring buffer and writes
+	 them as Chrome trace-event JSON, readable by chrome://tracing and Perfetto. Signal cascades show up
+	 as nested events. Call Write after Stop, events still being recorded could be written torn.
+	 The names of the signals (CSignal::SetName) must outlive the tracer.
+	 A ring that wrapped lost the oldest events, so the ends whose begins were overwritten are dropped when
+	 writing, and the events keep balanced.
+	 */
+	class CTracer
+	{
+	public:
+		static CTracer& Instance()
+		{
+			static CTracer tracer;
+			return tracer;
+		}
+
+	public:
+		void Start() { m_isEnabled.store(true, std::memory_order_relaxed); }
+
+		void Stop() { m_isEnabled.store(false, std::memory_order_relaxed); }
+
+		const bool IsEnabled() const { return m_isEnabled.load(std::memory_order_relaxed); }
+
+		void Record(const STraceEvent::EPhase phase, const STraceEvent::EKind kind, const char* name, const void* id, const void* function);
+
+		// Forgets the recorded events. Don't call it while tracing.
+		void Clear();
+
+		const bool Write(const char* path) const;
+
+	private:
+		CTracer() : m_isEnabled(false) {}
+
+		CTraceBuffer* ThreadBuffer();
+
+		static void WriteEvent(FILE* file, const STraceEvent& event, const unsigned threadId, const bool isFirst);
+
+		// Writes the characters escaped for a JSON string
+		static void WriteEscaped(FILE* file, const char* text);
+
+	private:
+		std::atomic<bool>							m_isEnabled;
+
+		// Only locked when a thread records its first event and when writing
+		mutable std::mutex							m_mutex;
+		std::vector<std::unique_ptr<CTraceBuffer>>	m_buffers;
+	};
+
+	/*
+	 Scopes used by the signals, see the DCPP_SIGNALS_TRACE_* macros
+	 */
+	class CTraceEmitScope
+	{
+	public:
+		CTraceEmitScope(const char* name, const void* id) :
+			m_isActive(CTracer::Instance().IsEnabled()),
+			mp_name(name),
+			mp_id(id)
+		{
+			if (m_isActive) CTracer::Instance().Record(STraceEvent::BEGIN, STraceEvent::EMIT, mp_name, mp_id, 0);
+		}
+
+		~CTraceEmitScope()
+		{
+			if (m_isActive) CTracer::Instance().Record(STraceEvent::END, STraceEvent::EMIT, mp_name, mp_id, 0);
+		}
+
+	private:
+		const bool		m_isActive;
+		const char*		mp_name;
+		const void*		mp_id;
+	};
+
+	class CTraceSlotScope
+	{
+	public:
+		template<typename TConnection>
+		explicit CTraceSlotScope(const TConnection& connection) :
+			m_isActive(CTracer::Instance().IsEnabled()),
+			mp_object(m_isActive ? connection.ObjectAddress() : 0),
+			mp_function(m_isActive ? connection.FunctionAddress() : 0)
+		{
+			if (m_isActive) CTracer::Instance().Record(STraceEvent::BEGIN, STraceEvent::SLOT, 0, mp_object, mp_function);
+		}
+
+		~CTraceSlotScope()
+		{
+			if (m_isActive) CTracer::Instance().Record(STraceEvent::END, STraceEvent::SLOT, 0, mp_object, mp_function);
+		}
+
+	private:
+		const bool		m_isActive;
+		const void*		mp_object;
+		const void*		mp_function;
+	};
+
+	inline void CTracer::Record(const STraceEvent::EPhase phase, const STraceEvent::EKind kind, const char* name, const void* id, const void* function)
+	{
+		STraceEvent event;
+		event.time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		event.mp_name = name;
+		event.mp_id = id;
+		event.mp_function = function;
+		event.phase = static_cast<unsigned char>(phase);
+		event.kind = static_cast<unsigned char>(kind);
+
+		ThreadBuffer()->Push(event);
+	}
+
+	inline void CTracer::Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const std::unique_ptr<CTraceBuffer>& buffer : m_buffers)
+		{
+			buffer->m_head.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	inline const bool CTracer::Write(const char* path) const
+	{
+		FILE* file = fopen(path, "w");
+		if (!file) return false;
+
+		fprintf(file, "{\"traceEvents\":[\n");
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		bool isFirst = true;
+		for (const std::unique_ptr<CTraceBuffer>& buffer : m_buffers)
+		{
+			const unsigned long long head = buffer->m_head.load(std::memory_order_acquire);
+			const unsigned long long begin = head > CTraceBuffer::kCapacity ? head - CTraceBuffer::kCapacity : 0;
+
+			// The events of a thread are nested, an end without a begin lost it when the ring wrapped
+			unsigned long long depth = 0;
+			for (unsigned long long i = begin; i < head; ++i)
+			{
+				const STraceEvent& event = buffer->m_events[i & (CTraceBuffer::kCapacity - 1)];
+				if (event.phase == STraceEvent::BEGIN)
+				{
+					++depth;
+				}
+				else if (depth > 0)
+				{
+					--depth;
+				}
+				else
+				{
+					continue;
+				}
+
+				WriteEvent(file, event, buffer->m_threadId, isFirst);
+				isFirst = false;
+			}
+		}
+
+		fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+		return fclose(file) == 0;
+	}
+
+	inline CTraceBuffer* CTracer::ThreadBuffer()
+	{
+		// Owned by the tracer, so the events survive the thread
+		static thread_local CTraceBuffer* threadBuffer = 0;
+		if (!threadBuffer)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_buffers.push_back(std::unique_ptr<CTraceBuffer>(new CTraceBuffer(m_buffers.size() + 1)));
+			threadBuffer = m_buffers.back().get();
+		}
+		return threadBuffer;
+	}
+
+	inline void CTracer::WriteEvent(FILE* file, const STraceEvent& event, const unsigned threadId, const bool isFirst)
+	{
+		const char phase = event.phase == STraceEvent::BEGIN ? 'B' : 'E';
+		const double microseconds = event.time / 1000.0;
+
+		if (!isFirst) fprintf(file, ",\n");
+
+		if (event.kind == STraceEvent::EMIT)
+		{
+			if (event.mp_name)
+			{
+				fprintf(file, "{\"name\":\"");
+				WriteEscaped(file, event.mp_name);
+				fprintf(file, "\",\"cat\":\"signal\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"signal\":\"%p\"}}",
+					phase, microseconds, threadId, event.mp_id);
+			}
+			else
+			{
+				fprintf(file, "{\"name\":\"signal %p\",\"cat\":\"signal\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+					event.mp_id, phase, microseconds, threadId);
+			}
+		}
+		else
+		{
+			fprintf(file, "{\"name\":\"slot\",\"cat\":\"slot\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"object\":\"%p\",\"function\":\"%p\"}}",
+				phase, microseconds, threadId, event.mp_id, event.mp_function);
+		}
+	}
+
+	inline void CTracer::WriteEscaped(FILE* file, const char* text)
+	{
+		for (; *text; ++text)
+		{
+			const unsigned char character = static_cast<unsigned char>(*text);
+			if (character == '"' || character == '\\')
+			{
+				fprintf(file, "\\%c", character);
+			}
+			else if (character < 0x20)
+			{
+				fprintf(file, "\\u%04x", character);
+			}
+			else
+			{
+				fputc(character, file);
+			}
+		}
+	}
+}
@@ -0,0 +1,257 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * allocation_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include <string>
+#include <functional>
+
+#include <signals/signal.h>
+
+////////////////////////////////////////////////////////////////////////
+// Counting allocation hooks. This header must be included only once in
+// the test program, since it replaces the global operators.
+////////////////////////////////////////////////////////////////////////
+
+std::atomic<unsigned long> g_allocationCount(0);
+
+void* operator new(std::size_t size)
+{
+	g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	void* memory = malloc(size ? size : 1);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+	g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	void* memory = malloc(size ? size : 1);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	free(memory);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* memory, std::size_t size) noexcept
+{
+	free(memory);
+}
+
+void operator delete[](void* memory, std::size_t size) noexcept
+{
+	free(memory);
+}
+#endif
+
+/*
+ Counts the allocations done since its construction
+ */
+class CAllocationCounter
+{
+public:
+	CAllocationCounter() : m_begin(g_allocationCount.load()) {}
+
+public:
+	const unsigned long Count() const { return g_allocationCount.load() - m_begin; }
+
+private:
+	const unsigned long m_begin;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////
+
+template<typename TSignal, typename... Args>
+const unsigned long AllocationsPerEmission(TSignal& signal, const Args&... args)
+{
+	const TSignal& constSignal = signal;
+
+	// The first emission warms up anything lazily created
+	signal(args...);
+
+	CAllocationCounter counter;
+	for (int i = 0; i < 16; ++i)
+	{
+		signal(args...);
+		constSignal(args...);
+	}
+	return counter.Count();
+}
+
+template<typename TSignal, typename TArray, typename... Args>
+const unsigned long AllocationsPerValuesEmission(TSignal& signal, TArray& values, const Args&... args)
+{
+	const TSignal& constSignal = signal;
+	signal(values, args...);
+
+	CAllocationCounter counter;
+	for (int i = 0; i < 16; ++i)
+	{
+		signal(values, args...);
+		constSignal(values, args...);
+	}
+	return counter.Count();
+}
+
+const bool AllocationTestEmissions()
+{
+	printf("+ INIT ALLOCATION FREE EMISSION TEST\n");
+	bool succeed = true;
+
+	Foo foo;
+	const Foo constFoo;
+	TCountingFunctor functor;
+	auto lambda = [](const std::string& message) {};
+	std::function<void(const std::string&)> stdFunction = lambda;
+	auto binded = std::bind(&Foo::PrintStringRefConst, &foo, std::placeholders::_1);
+
+	// Every kind of slot
+	dc::CSignal<void(const std::string&)> signal;
+	signal.Connect(&FreeFunctionPrintStringRef);
+	signal.Connect(lambda);
+	signal.Connect(stdFunction);
+	signal.Connect(binded);
+	signal.Connect(&foo, &Foo::PrintStringRefConst);
+	signal.Connect(&constFoo, &Foo::PrintStringRefConst);
+
+	// Long enough to not fit in the small string buffer
+	const std::string message = "No allocations during the emissions of the signals";
+	succeed &= AllocationsPerEmission(signal, message) == 0;
+
+	dc::CSignal<void(const char*)> functorSignal;
+	functorSignal.Connect(functor);
+	functorSignal.Connect(&foo, &Foo::PrintString);
+	functorSignal.Connect(&Foo::StaticPrintString);
+	succeed &= AllocationsPerEmission(functorSignal, "No allocations") == 0;
+
+	// Recovering values
+	dc::CSignal<const bool(void)> valuesSignal;
+	valuesSignal.Connect(&FreeFunctionReturnBool);
+	valuesSignal.Connect(&Foo::StaticFunctionReturnBool);
+	valuesSignal.Connect(&foo, &Foo::MemberFunctionReturnBool);
+
+	bool values[3];
+	succeed &= AllocationsPerValuesEmission(valuesSignal, values) == 0;
+
+	// One-shot connections are removed without allocating
+	{
+		CAllocationCounter counter;
+		functorSignal.ConnectOnce(functor);
+		const unsigned long connectAllocations = counter.Count();
+
+		CAllocationCounter emitCounter;
+		functorSignal("One-shot");
+		succeed &= emitCounter.Count() == 0;
+
+		printf("Allocations connecting a one-shot slot: %lu\n", connectAllocations);
+	}
+
+	assert(succeed && "[Allocation free emission tests FAILED]");
+
+	printf("- END ALLOCATION FREE EMISSION TEST\n");
+	return succeed;
+}
+
+const bool AllocationTestConnections()
+{
+	printf("+ INIT ALLOCATIONS PER CONNECTION TEST\n");
+	bool succeed = true;
+
+	TCountingFunctor functors[64];
+	dc::CSignal<void(const char*)> signal;
+
+	CAllocationCounter connectCounter;
+	for (TCountingFunctor& functor : functors)
+	{
+		signal.Connect(functor);
+	}
+	const unsigned long connectAllocations = connectCounter.Count();
+
+	CAllocationCounter disconnectCounter;
+	for (TCountingFunctor& functor : functors)
+	{
+		signal.Disconnect(functor);
+	}
+	const unsigned long disconnectAllocations = disconnectCounter.Count();
+
+	printf("Allocations for 64 Connect: %lu, for 64 Disconnect: %lu\n", connectAllocations, disconnectAllocations);
+
+	// The binding plus the geometric growth of the connections storage
+	succeed &= connectAllocations <= 8;
+	succeed &= disconnectAllocations == 0;
+
+	// The owned callables reuse the blocks freed in the slab allocator
+	signal.Reserve(64);
+	for (int i = 0; i < 64; ++i)
+	{
+		signal.ConnectOwned(TCountingFunctor());
+	}
+	signal.Clear();
+
+	CAllocationCounter ownedCounter;
+	for (int i = 0; i < 64; ++i)
+	{
+		signal.ConnectOwned(TCountingFunctor());
+	}
+	signal.Clear();
+	const unsigned long ownedAllocations = ownedCounter.Count();
+
+	printf("Allocations for 64 owned Connect after warming up: %lu\n", ownedAllocations);
+	succeed &= ownedAllocations == 0;
+
+	assert(succeed && "[Allocations per connection tests FAILED]");
+
+	printf("- END ALLOCATIONS PER CONNECTION TEST\n");
+	return succeed;
+}
+
+void TestDCAllocations()
+{
+	printf("+++ TEST DC ALLOCATIONS\n\n");
+
+	bool succeed = true;
+	succeed &= AllocationTestEmissions();
+	succeed &= AllocationTestConnections();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC ALLOCATIONS\n");
+}
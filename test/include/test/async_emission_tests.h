@@ -0,0 +1,208 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * async_emission_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <atomic>
+#include <future>
+#include <vector>
+#include <stdexcept>
+
+#include <signals/async_emission.h>
+
+int AsyncDouble(int value) { return value * 2; }
+
+/*
+ Counts how many times it is copied
+ */
+struct TCopyCounter
+{
+	explicit TCopyCounter(std::atomic<int>* copies) : mp_copies(copies) {}
+
+	TCopyCounter(const TCopyCounter& copy) : mp_copies(copy.mp_copies) { ++*mp_copies; }
+
+	std::atomic<int>* mp_copies;
+};
+
+/*
+ Runs the tasks when asked, in the thread asking
+ */
+class CManualExecutor : public dc::CExecutor
+{
+public:
+	void Post(TTask&& task) override { m_tasks.push_back(std::move(task)); }
+
+	const unsigned RunAll()
+	{
+		const unsigned count = m_tasks.size();
+		for (TTask& task : m_tasks)
+		{
+			task();
+		}
+		m_tasks.clear();
+		return count;
+	}
+
+private:
+	std::vector<TTask> m_tasks;
+};
+
+const bool AsyncEmissionTestValues()
+{
+	printf("+ INIT ASYNC EMISSION VALUES TEST\n");
+	bool succeed = true;
+
+	auto triple = [](int value) { return value * 3; };
+
+	dc::CSignal<int(int)> signal;
+	signal.Connect(&AsyncDouble);
+	signal.Connect(triple);
+	signal.ConnectOwned([](int value) { return value * 4; });
+
+	// Same order than the connections
+	std::future<std::vector<int>> future = dc::EmitAsync(signal, 10);
+	const std::vector<int> values = future.get();
+	succeed &= values.size() == 3;
+	succeed &= values[0] == 20 && values[1] == 30 && values[2] == 40;
+
+	// Bool values, the case std::vector<bool> doesn't allow writing concurrently
+	dc::CSignal<const bool(void)> boolSignal;
+	for (int i = 0; i < 32; ++i)
+	{
+		boolSignal.ConnectOwned([i]() { return i % 2 == 0; });
+	}
+	const std::vector<bool> bools = dc::EmitAsync(boolSignal).get();
+	succeed &= bools.size() == 32;
+	for (unsigned i = 0; i < bools.size(); ++i)
+	{
+		succeed &= bools[i] == (i % 2 == 0);
+	}
+
+	// Nothing connected, the future is ready
+	dc::CSignal<int(int)> empty;
+	succeed &= dc::EmitAsync(empty, 1).get().empty();
+
+	assert(succeed && "[Async emission values tests FAILED]");
+
+	printf("- END ASYNC EMISSION VALUES TEST\n");
+	return succeed;
+}
+
+const bool AsyncEmissionTestVoid()
+{
+	printf("+ INIT ASYNC EMISSION VOID TEST\n");
+	bool succeed = true;
+
+	std::atomic<int> calls(0);
+	auto increment = [&calls](const TCopyCounter& counter) { ++calls; };
+
+	dc::CSignal<void(const TCopyCounter&)> signal;
+	for (int i = 0; i < 16; ++i)
+	{
+		signal.ConnectOwned(increment);
+	}
+	signal.ConnectOnce(increment);
+
+	// The arguments are copied once for all the slots
+	std::atomic<int> copies(0);
+	TCopyCounter counter(&copies);
+	dc::EmitAsync(signal, counter).get();
+	succeed &= calls == 17;
+	succeed &= copies == 1;
+
+	// The one-shot connection was consumed
+	dc::EmitAsync(signal, counter).get();
+	succeed &= calls == 33;
+	succeed &= signal.Count() == 16;
+
+	assert(succeed && "[Async emission void tests FAILED]");
+
+	printf("- END ASYNC EMISSION VOID TEST\n");
+	return succeed;
+}
+
+const bool AsyncEmissionTestExecutor()
+{
+	printf("+ INIT ASYNC EMISSION EXECUTOR TEST\n");
+	bool succeed = true;
+
+	CManualExecutor executor;
+	int calls = 0;
+
+	dc::CSignal<int(int)> signal;
+	signal.ConnectOwned([&calls](int value) { ++calls; return value + 1; });
+	signal.ConnectOwned([&calls](int value) -> int { ++calls; throw std::runtime_error("Slot failed"); });
+
+	// The caller returns before any slot runs
+	std::future<std::vector<int>> future = dc::EmitAsyncOn(executor, signal, 1);
+	succeed &= calls == 0;
+	succeed &= future.wait_for(std::chrono::seconds(0)) == std::future_status::timeout;
+
+	// Connecting after the emission doesn't change it
+	signal.Connect(&AsyncDouble);
+	succeed &= executor.RunAll() == 2;
+	succeed &= calls == 2;
+
+	// The exception of the slot reaches the future
+	bool hasThrown = false;
+	try
+	{
+		future.get();
+	}
+	catch (const std::runtime_error& error)
+	{
+		hasThrown = true;
+	}
+	succeed &= hasThrown;
+
+	// A pool of its own
+	dc::CThreadPool pool(2);
+	succeed &= pool.ThreadCount() == 2;
+
+	dc::CSignal<int(int)> poolSignal;
+	poolSignal.Connect(&AsyncDouble);
+	succeed &= dc::EmitAsyncOn(pool, poolSignal, 21).get()[0] == 42;
+
+	assert(succeed && "[Async emission executor tests FAILED]");
+
+	printf("- END ASYNC EMISSION EXECUTOR TEST\n");
+	return succeed;
+}
+
+void TestDCAsyncEmission()
+{
+	printf("+++ TEST DC ASYNC EMISSION\n\n");
+
+	bool succeed = true;
+	succeed &= AsyncEmissionTestValues();
+	succeed &= AsyncEmissionTestVoid();
+	succeed &= AsyncEmissionTestExecutor();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC ASYNC EMISSION\n");
+}
@@ -0,0 +1,157 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * bubbling_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <signals/bubbling_signal.h>
+
+#include "allocation_tests.h"
+
+/*
+ Handler of a node, appends its tag to the trace and stops the propagation if asked to
+ */
+struct TClickHandler
+{
+	TClickHandler(std::string* trace, const char tag, const bool isStopping = false) :
+		mp_trace(trace),
+		m_tag(tag),
+		m_isStopping(isStopping)
+	{}
+
+	bool operator()(int x, int y)
+	{
+		mp_trace->push_back(m_tag);
+		return m_isStopping;
+	}
+
+	std::string*	mp_trace;
+	char			m_tag;
+	bool			m_isStopping;
+};
+
+using TClickSignal = dc::CBubblingSignal<bool(int, int)>;
+
+const bool BubblingTestPropagation()
+{
+	printf("+ INIT BUBBLING PROPAGATION TEST\n");
+	bool succeed = true;
+
+	std::string trace;
+	TClickHandler onWindow(&trace, 'w'), onPanel(&trace, 'p'), onPanelStop(&trace, 's', true), onButton(&trace, 'b');
+
+	TClickSignal window;
+	TClickSignal panel(&window);
+	TClickSignal button(&panel);
+	window.Connect(onWindow);
+	panel.Connect(onPanel);
+	button.Connect(onButton);
+
+	// From the node to the root
+	succeed &= !button(10, 20);
+	succeed &= trace == "bpw";
+
+	// Stopping keeps the rest of the slots of the node
+	panel.Connect(onPanelStop);
+	panel.Connect(onPanel);
+	trace.clear();
+	succeed &= button(10, 20);
+	succeed &= trace == "bpsp";
+
+	// The paths of the subtree are rebuilt after reparenting
+	TClickSignal dialog(&window);
+	TClickHandler onDialog(&trace, 'd');
+	dialog.Connect(onDialog);
+	panel.SetParent(&dialog);
+	panel.Disconnect(onPanelStop);
+	trace.clear();
+	button(10, 20);
+	succeed &= trace == "bppdw";
+
+	// Destroying a node makes its children roots
+	{
+		TClickSignal overlay(&window);
+		button.SetParent(&overlay);
+		succeed &= button.Parent() == &overlay;
+	}
+	succeed &= button.Parent() == 0;
+	trace.clear();
+	button(10, 20);
+	succeed &= trace == "b";
+
+	assert(succeed && "[Bubbling propagation tests FAILED]");
+
+	printf("- END BUBBLING PROPAGATION TEST\n");
+	return succeed;
+}
+
+const bool BubblingTestDepth()
+{
+	printf("+ INIT BUBBLING DEPTH TEST\n");
+	bool succeed = true;
+
+	// A deep chain bubbles without recursion nor allocations
+	const unsigned depth = 10000;
+	std::vector<TClickSignal*> nodes;
+	nodes.push_back(new TClickSignal());
+	for (unsigned i = 1; i < depth; ++i)
+	{
+		nodes.push_back(new TClickSignal(nodes.back()));
+	}
+
+	int clicks = 0;
+	nodes.front()->ConnectOwned([&clicks](int, int) { ++clicks; return true; });
+	(*nodes.back())(0, 0);
+
+	CAllocationCounter counter;
+	succeed &= (*nodes.back())(1, 1);
+	succeed &= counter.Count() == 0;
+	succeed &= clicks == 2;
+
+	// Destroying from the root
+	for (TClickSignal* node : nodes) delete node;
+
+	assert(succeed && "[Bubbling depth tests FAILED]");
+
+	printf("- END BUBBLING DEPTH TEST\n");
+	return succeed;
+}
+
+void TestDCBubbling()
+{
+	printf("+++ TEST DC BUBBLING\n\n");
+
+	bool succeed = true;
+	succeed &= BubblingTestPropagation();
+	succeed &= BubblingTestDepth();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC BUBBLING\n");
+}
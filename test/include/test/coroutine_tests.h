@@ -0,0 +1,172 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * coroutine_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <tuple>
+
+#include <signals/coroutine.h>
+
+#include "allocation_tests.h"
+
+#if defined(__cpp_impl_coroutine)
+
+dc::CSlotTask CoroutineSumValues(dc::CSignal<void(int)>& signal, int count, int* sum)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		*sum += co_await signal;
+	}
+}
+
+dc::CSlotTask CoroutineWaitAll(dc::CSignal<void()>& started, dc::CSignal<void(const std::string&, int)>& message, std::string* result)
+{
+	co_await started;
+
+	const std::tuple<std::string, int> values = co_await message;
+	*result = std::get<0>(values) + std::to_string(std::get<1>(values));
+}
+
+dc::CSlotTask CoroutineAwaitAgain(dc::CSignal<void(std::string)>& signal, std::string first, std::string* trace)
+{
+	*trace += first + ";";
+	const std::string next = co_await signal;
+	*trace += "next " + next + ";";
+}
+
+const bool CoroutineTestAwait()
+{
+	printf("+ INIT COROUTINE AWAIT TEST\n");
+	bool succeed = true;
+
+	// Every emission resumes the coroutine with its value
+	dc::CSignal<void(int)> signal;
+	int sum = 0;
+	CoroutineSumValues(signal, 3, &sum);
+	signal(1);
+	signal(2);
+	succeed &= sum == 3;
+
+	// Waiting again in the resumed coroutine doesn't allocate
+	CAllocationCounter counter;
+	signal(3);
+	succeed &= sum == 6;
+	succeed &= counter.Count() == 0;
+
+	// Finished, later emissions don't reach it
+	signal(4);
+	succeed &= sum == 6;
+
+	// Several signals, without arguments and with many of them
+	dc::CSignal<void()> started;
+	dc::CSignal<void(const std::string&, int)> message;
+	std::string result;
+	std::string otherResult;
+	CoroutineWaitAll(started, message, &result);
+	CoroutineWaitAll(started, message, &otherResult);
+
+	message("Too early", 0);
+	started();
+	message("Value ", 42);
+	succeed &= result == "Value 42";
+	succeed &= otherResult == "Value 42";
+
+	assert(succeed && "[Coroutine await tests FAILED]");
+
+	printf("- END COROUTINE AWAIT TEST\n");
+	return succeed;
+}
+
+const bool CoroutineTestSlots()
+{
+	printf("+ INIT COROUTINE SLOTS TEST\n");
+	bool succeed = true;
+
+	dc::CSignal<void(int)> request;
+	dc::CSignal<void(int)> response;
+	int total = 0;
+
+	// Every request waits for its response
+	dc::ConnectCoroutine(request, [&response, &total](int value) -> dc::CSlotTask
+	{
+		const int answer = co_await response;
+		total += value * answer;
+	});
+
+	request(2);
+	request(3);
+	succeed &= total == 0;
+
+	// Both requests waiting are resumed by the same emission
+	response(10);
+	succeed &= total == 50;
+
+	response(10);
+	succeed &= total == 50;
+
+	// A slot awaiting its own signal waits for the next emission, not the one running it
+	dc::CSignal<void(std::string)> text;
+	std::string trace;
+	dc::ConnectCoroutine(text, [&text, &trace](std::string value) { CoroutineAwaitAgain(text, value, &trace); });
+
+	text("a");
+	succeed &= trace == "a;";
+
+	text.Clear();
+	text("b");
+	succeed &= trace == "a;next b;";
+
+	assert(succeed && "[Coroutine slots tests FAILED]");
+
+	printf("- END COROUTINE SLOTS TEST\n");
+	return succeed;
+}
+
+void TestDCCoroutines()
+{
+	printf("+++ TEST DC COROUTINES\n\n");
+
+	bool succeed = true;
+	succeed &= CoroutineTestAwait();
+	succeed &= CoroutineTestSlots();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC COROUTINES\n");
+}
+
+#else
+
+void TestDCCoroutines()
+{
+	printf("+++ TEST DC COROUTINES\n\n");
+	printf("Coroutines are not available, compile as C++20 to test them\n");
+	printf("---END TEST DC COROUTINES\n");
+}
+
+#endif
@@ -0,0 +1,333 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * emission_log_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <signals/emission_log.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+struct TOversized {};
+
+namespace dc
+{
+	/*
+	 Codec of the strings, written as their length followed by their characters
+	 */
+	template<>
+	struct TSignalCodec<std::string>
+	{
+		static const std::size_t Size(const std::string& value) { return sizeof(uint32_t) + value.size(); }
+
+		static void Encode(const std::string& value, char*& cursor)
+		{
+			TSignalCodec<uint32_t>::Encode(value.size(), cursor);
+			memcpy(cursor, value.data(), value.size());
+			cursor += value.size();
+		}
+
+		static const bool Decode(const char*& cursor, const char* end, std::string& value)
+		{
+			uint32_t size = 0;
+			if (!TSignalCodec<uint32_t>::Decode(cursor, end, size) || static_cast<std::size_t>(end - cursor) < size) return false;
+
+			value.assign(cursor, size);
+			cursor += size;
+			return true;
+		}
+	};
+
+	/*
+	 Codec claiming a size no file can grow to
+	 */
+	template<>
+	struct TSignalCodec<TOversized>
+	{
+		static const std::size_t Size(const TOversized& value) { return std::size_t(1) << 62; }
+
+		static void Encode(const TOversized& value, char*& cursor) {}
+
+		static const bool Decode(const char*& cursor, const char* end, TOversized& value) { return true; }
+	};
+}
+
+struct TPointerEvent
+{
+	int		x;
+	int		y;
+	float	pressure;
+};
+
+const bool EmissionLogTestRecordReplay()
+{
+	printf("+ INIT EMISSION LOG RECORD AND REPLAY TEST\n");
+	bool succeed = true;
+
+	const char* logPath = "dcpp_signals_emissions.log";
+
+	dc::CSignal<void(const TPointerEvent&)> pointer;
+	dc::CSignal<void(const std::string&, int)> command;
+	dc::CSignal<void(int)> ignored;
+	{
+		// A small capacity so the mapping grows while recording
+		dc::CEmissionRecorder recorder(logPath, 64);
+		succeed &= recorder.IsOpen();
+		succeed &= recorder.Record(pointer, 0);
+		succeed &= recorder.Record(command, 1);
+		succeed &= recorder.Record(ignored, 2);
+
+		for (int i = 0; i < 100; ++i)
+		{
+			pointer(TPointerEvent{ i, -i, i * 0.5f });
+			if (i % 10 == 0) command("save", i);
+		}
+		ignored(7);
+		succeed &= recorder.Size() > 100 * sizeof(TPointerEvent);
+	}
+
+	// The recorder disconnected when closed
+	succeed &= pointer.Count() == 0 && command.Count() == 0;
+
+	// Replaying in other signals with the same signatures
+	dc::CSignal<void(const TPointerEvent&)> replayedPointer;
+	dc::CSignal<void(const std::string&, int)> replayedCommand;
+
+	std::vector<TPointerEvent> events;
+	std::string commands;
+	replayedPointer.ConnectOwned([&events](const TPointerEvent& event) { events.push_back(event); });
+	replayedCommand.ConnectOwned([&](const std::string& name, int index)
+	{
+		// Interleaved with the pointer events like when they were recorded
+		succeed &= events.size() == static_cast<std::size_t>(index + 1);
+		commands += name + std::to_string(index) + ";";
+	});
+
+	dc::CEmissionReplayer replayer(logPath);
+	succeed &= replayer.IsOpen();
+	replayer.Bind(replayedPointer, 0);
+	replayer.Bind(replayedCommand, 1);
+
+	// The records of channels not bound are read but not emitted
+	succeed &= replayer.Replay() == 111;
+	succeed &= events.size() == 100;
+	succeed &= events[42].x == 42 && events[42].y == -42 && events[42].pressure == 21.0f;
+	succeed &= commands == "save0;save10;save20;save30;save40;save50;save60;save70;save80;save90;";
+
+	// Stepping after rewinding
+	replayer.Rewind();
+	succeed &= replayer.Next();
+	succeed &= events.size() == 101 && events.back().x == 0;
+
+	remove(logPath);
+
+	// Nothing to read once the file is gone
+	dc::CEmissionReplayer missing(logPath);
+	succeed &= !missing.IsOpen() && !missing.Next();
+
+	assert(succeed && "[Emission log record and replay tests FAILED]");
+
+	printf("- END EMISSION LOG RECORD AND REPLAY TEST\n");
+	return succeed;
+}
+
+const bool EmissionLogTestLaterConnections()
+{
+	printf("+ INIT EMISSION LOG LATER CONNECTIONS TEST\n");
+	bool succeed = true;
+
+	const char* logPath = "dcpp_signals_later_connections.log";
+
+	int emissions = 0;
+	const auto& count = [&emissions](int value) { ++emissions; };
+
+	dc::CSignal<void(int)> signal;
+	{
+		// The slots connected after the recorder reallocate the connections of the signal
+		dc::CEmissionRecorder recorder(logPath);
+		succeed &= recorder.Record(signal, 0);
+		for (int i = 0; i < 20; ++i)
+		{
+			signal.Connect(count);
+		}
+		signal(1);
+	}
+
+	// Only the recorder was disconnected
+	succeed &= signal.Count() == 20;
+	signal(2);
+	succeed &= emissions == 40;
+
+	dc::CEmissionReplayer replayer(logPath);
+	succeed &= replayer.Replay() == 1;
+
+	remove(logPath);
+
+	assert(succeed && "[Emission log later connections tests FAILED]");
+
+	printf("- END EMISSION LOG LATER CONNECTIONS TEST\n");
+	return succeed;
+}
+
+const bool EmissionLogTestMismatchedBinding()
+{
+	printf("+ INIT EMISSION LOG MISMATCHED BINDING TEST\n");
+	bool succeed = true;
+
+	const char* logPath = "dcpp_signals_mismatched_binding.log";
+
+	dc::CSignal<void(int)> value;
+	dc::CSignal<void(const std::string&)> name;
+	{
+		dc::CEmissionRecorder recorder(logPath);
+		succeed &= recorder.Record(value, 0);
+		succeed &= recorder.Record(name, 1);
+
+		// The channels are capped, so the replayer can index them
+		succeed &= !recorder.Record(value, dc::detail::kMaxEmissionChannels);
+
+		value(7);
+		name("load");
+	}
+
+	unsigned emissions = 0;
+	dc::CSignal<void(const TPointerEvent&)> pointer;
+	dc::CSignal<void(int)> truncated;
+	pointer.ConnectOwned([&emissions](const TPointerEvent& event) { ++emissions; });
+	truncated.ConnectOwned([&emissions](int value) { ++emissions; });
+
+	dc::CEmissionReplayer replayer(logPath);
+	succeed &= !replayer.Bind(pointer, dc::detail::kMaxEmissionChannels);
+	succeed &= !replayer.Bind(pointer, 0xFFFFFFFF);
+
+	// The record is shorter than the arguments of the signal in the first channel, and longer in the second one
+	succeed &= replayer.Bind(pointer, 0);
+	succeed &= replayer.Bind(truncated, 1);
+	succeed &= replayer.Replay() == 2;
+	succeed &= replayer.RejectedCount() == 2;
+	succeed &= emissions == 0;
+
+	remove(logPath);
+
+	assert(succeed && "[Emission log mismatched binding tests FAILED]");
+
+	printf("- END EMISSION LOG MISMATCHED BINDING TEST\n");
+	return succeed;
+}
+
+const bool EmissionLogTestGrowFailure()
+{
+	printf("+ INIT EMISSION LOG GROW FAILURE TEST\n");
+	bool succeed = true;
+
+	const char* logPath = "dcpp_signals_grow_failure.log";
+
+	dc::CSignal<void(int)> signal;
+	dc::CSignal<void(const TOversized&)> oversized;
+	{
+		dc::CEmissionRecorder recorder(logPath, 64);
+		recorder.Record(signal, 0);
+		recorder.Record(oversized, 1);
+
+		// The record that can't fit is dropped and the mapping kept
+		signal(1);
+		oversized(TOversized());
+		succeed &= recorder.IsOpen();
+		signal(2);
+	}
+
+	dc::CEmissionReplayer replayer(logPath);
+	succeed &= replayer.Replay() == 2;
+
+	remove(logPath);
+
+	assert(succeed && "[Emission log grow failure tests FAILED]");
+
+	printf("- END EMISSION LOG GROW FAILURE TEST\n");
+	return succeed;
+}
+
+void TestDCEmissionLog()
+{
+	printf("+++ TEST DC EMISSION LOG\n\n");
+
+	bool succeed = true;
+	succeed &= EmissionLogTestRecordReplay();
+	succeed &= EmissionLogTestLaterConnections();
+	succeed &= EmissionLogTestGrowFailure();
+	succeed &= EmissionLogTestMismatchedBinding();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC EMISSION LOG\n");
+}
+
+#else
+
+const bool EmissionLogTestGrowFailure()
+{
+	printf("+ INIT EMISSION LOG GROW FAILURE TEST\n");
+	bool succeed = true;
+
+	const char* logPath = "dcpp_signals_grow_failure.log";
+
+	dc::CSignal<void(int)> signal;
+	dc::CSignal<void(const TOversized&)> oversized;
+	{
+		dc::CEmissionRecorder recorder(logPath, 64);
+		recorder.Record(signal, 0);
+		recorder.Record(oversized, 1);
+
+		// The record that can't fit is dropped and the mapping kept
+		signal(1);
+		oversized(TOversized());
+		succeed &= recorder.IsOpen();
+		signal(2);
+	}
+
+	dc::CEmissionReplayer replayer(logPath);
+	succeed &= replayer.Replay() == 2;
+
+	remove(logPath);
+
+	assert(succeed && "[Emission log grow failure tests FAILED]");
+
+	printf("- END EMISSION LOG GROW FAILURE TEST\n");
+	return succeed;
+}
+
+void TestDCEmissionLog()
+{
+	printf("+++ TEST DC EMISSION LOG\n\n");
+	printf("Memory-mapped files are not available in this platform\n");
+	printf("---END TEST DC EMISSION LOG\n");
+}
+
+#endif
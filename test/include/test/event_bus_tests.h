@@ -0,0 +1,155 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_bus_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+
+#include <signals/event_bus.h>
+
+// Topic ids computed at compile time
+constexpr dc::TTopicId kConfigLoadedTopic = dc::HashTopic("config.loaded");
+constexpr dc::TTopicId kRequestDoneTopic = dc::HashTopic("request.done");
+
+static_assert(kConfigLoadedTopic != kRequestDoneTopic, "Different topics should have different ids");
+
+class CTopicListener
+{
+public:
+	CTopicListener(): received(0) {}
+
+public:
+	void OnTopic(const std::string& message) { ++received; }
+
+public:
+	int received;
+};
+
+const bool EventBusTestPublishing()
+{
+	printf("+ INIT EVENT BUS TEST\n");
+	bool succeed = true;
+
+	CTopicListener listener;
+	dc::CEventBus<void(const std::string&)> bus;
+
+	// Registering by name or by precomputed id is the same
+	succeed &= dc::HashTopic("config.loaded") == kConfigLoadedTopic;
+	bus.Subscribe(kConfigLoadedTopic, &listener, &CTopicListener::OnTopic);
+	bus.Topic("request.done").Connect(&FreeFunctionPrintStringRef);
+
+	succeed &= bus.TopicCount() == 2;
+	succeed &= bus.Publish(kConfigLoadedTopic, "Config loaded");
+	succeed &= bus.Publish(kRequestDoneTopic, "Request done");
+	succeed &= !bus.Publish(dc::HashTopic("nobody.listens"), "Lost message");
+	succeed &= listener.received == 1;
+
+	// Registering many topics makes the table grow, the connections survive it
+	char name[32];
+	for (int i = 0; i < 100; ++i)
+	{
+		snprintf(name, sizeof(name), "topic.%d", i);
+		bus.Subscribe(dc::HashTopic(name), &listener, &CTopicListener::OnTopic);
+	}
+	succeed &= bus.TopicCount() == 102;
+
+	bus.Publish(kConfigLoadedTopic, "Config loaded again");
+	bus.Publish(dc::HashTopic("topic.42"), "Topic 42");
+	succeed &= listener.received == 3;
+
+	bus.Unsubscribe(kConfigLoadedTopic, &listener, &CTopicListener::OnTopic);
+	succeed &= bus.Find(kConfigLoadedTopic)->IsEmpty();
+
+	// The raw id 0 can't mark its entry as empty, it's the topic of the id 1
+	const dc::TTopicId zeroTopic = 0;
+	dc::CSignal<void(const std::string&)>& zero = bus.Topic(zeroTopic);
+	succeed &= &bus.Topic(zeroTopic) == &zero && bus.Find(1) == &zero;
+	succeed &= bus.TopicCount() == 103;
+	zero.Connect(&listener, &CTopicListener::OnTopic);
+	succeed &= bus.Publish(zeroTopic, "Topic 0") && bus.Publish(1, "Topic 1");
+	succeed &= listener.received == 5;
+
+	assert(succeed && "[Event bus tests FAILED]");
+
+	printf("- END EVENT BUS TEST\n");
+	return succeed;
+}
+
+const bool EventBusTestSubscribingSlot()
+{
+	printf("+ INIT EVENT BUS SUBSCRIBING SLOT TEST\n");
+	bool succeed = true;
+
+	CTopicListener listener;
+	dc::CEventBus<void(const std::string&)> bus;
+
+	// Looking up a registered topic doesn't grow the table
+	dc::CSignal<void(const std::string&)>& config = bus.Topic(kConfigLoadedTopic);
+	for (int i = 0; i < 20; ++i)
+	{
+		succeed &= &bus.Topic(kConfigLoadedTopic) == &config;
+	}
+
+	// A slot registering topics while it's published, the table grows under the emission
+	int topic = 0;
+	char name[32];
+	const auto& subscribe = [&](const std::string& message)
+	{
+		for (int i = 0; i < 50; ++i, ++topic)
+		{
+			snprintf(name, sizeof(name), "topic.%d", topic);
+			bus.Subscribe(dc::HashTopic(name), &listener, &CTopicListener::OnTopic);
+		}
+	};
+	config.Connect(subscribe);
+	config.Connect(&listener, &CTopicListener::OnTopic);
+
+	succeed &= bus.Publish(kConfigLoadedTopic, "Config loaded");
+	succeed &= bus.TopicCount() == 51;
+	succeed &= &bus.Topic(kConfigLoadedTopic) == &config;
+	succeed &= listener.received == 1;
+
+	bus.Publish(dc::HashTopic("topic.7"), "Topic 7");
+	succeed &= listener.received == 2;
+
+	assert(succeed && "[Event bus subscribing slot tests FAILED]");
+
+	printf("- END EVENT BUS SUBSCRIBING SLOT TEST\n");
+	return succeed;
+}
+
+void TestDCEventBus()
+{
+	printf("+++ TEST DC EVENT BUS\n\n");
+
+	bool succeed = EventBusTestPublishing();
+	succeed &= EventBusTestSubscribingSlot();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC EVENT BUS\n");
+}
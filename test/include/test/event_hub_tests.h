@@ -0,0 +1,99 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_hub_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <signals/event_hub.h>
+
+struct TDamageEvent
+{
+	int amount;
+};
+
+struct TLevelLoadedEvent
+{
+	const char* name;
+};
+
+struct TUnusedEvent
+{
+};
+
+class CGameListener
+{
+public:
+	CGameListener(): damage(0), levelsLoaded(0) {}
+
+public:
+	void OnDamage(const TDamageEvent& event) { damage += event.amount; }
+
+	void OnLevelLoaded(const TLevelLoadedEvent& event) { ++levelsLoaded; }
+
+public:
+	int damage;
+	int levelsLoaded;
+};
+
+const bool EventHubTestPublishing()
+{
+	printf("+ INIT EVENT HUB TEST\n");
+	bool succeed = true;
+
+	CGameListener listener;
+	dc::CEventHub hub;
+
+	hub.Subscribe<TDamageEvent>(&listener, &CGameListener::OnDamage);
+	hub.Subscribe<TLevelLoadedEvent>(&listener, &CGameListener::OnLevelLoaded);
+
+	succeed &= hub.Publish(TDamageEvent{ 10 });
+	succeed &= hub.Publish(TDamageEvent{ 5 });
+	succeed &= hub.Publish(TLevelLoadedEvent{ "Intro" });
+	succeed &= !hub.Publish(TUnusedEvent{});
+
+	succeed &= listener.damage == 15 && listener.levelsLoaded == 1;
+
+	hub.Unsubscribe<TDamageEvent>(&listener, &CGameListener::OnDamage);
+	hub.Publish(TDamageEvent{ 5 });
+	succeed &= listener.damage == 15 && hub.Channel<TDamageEvent>().IsEmpty();
+
+	assert(succeed && "[Event hub tests FAILED]");
+
+	printf("- END EVENT HUB TEST\n");
+	return succeed;
+}
+
+void TestDCEventHub()
+{
+	printf("+++ TEST DC EVENT HUB\n\n");
+
+	bool succeed = EventHubTestPublishing();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC EVENT HUB\n");
+}
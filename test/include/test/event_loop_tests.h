@@ -0,0 +1,231 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * event_loop_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <signals/signal.h>
+#include <signals/event_loop.h>
+#include <signals/async_emission.h>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <sys/epoll.h>
+
+const bool EventLoopTestWakeups()
+{
+	printf("+ INIT EVENT LOOP WAKEUPS TEST\n");
+	bool succeed = true;
+
+	dc::CEventLoopExecutor loop;
+	succeed &= loop.FileDescriptor() >= 0;
+
+	// A pipe stands for the sockets the loop waits on with the signals
+	int pipeFds[2];
+	succeed &= pipe(pipeFds) == 0;
+
+	const int epollFd = epoll_create1(0);
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.fd = loop.FileDescriptor();
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, loop.FileDescriptor(), &event);
+	event.data.fd = pipeFds[0];
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, pipeFds[0], &event);
+
+	// The slots run in the loop thread
+	const std::thread::id loopThread = std::this_thread::get_id();
+	dc::CSignal<void(int, const std::string&)> received;
+	int count = 0;
+	received.ConnectOwned([&](int value, const std::string& source) { succeed &= std::this_thread::get_id() == loopThread; ++count; });
+
+	// Posting many emissions before the loop waits makes it wake once, with a single write to the eventfd.
+	// The counter is read before draining, Drain finds it empty and still runs the emissions.
+	epoll_event events[2];
+	uint64_t notifications = 0;
+	for (int burst = 0; burst < 2; ++burst)
+	{
+		for (int i = 0; i < 100; ++i) loop.Emit(received, i, std::string("burst"));
+		succeed &= epoll_wait(epollFd, events, 2, 0) == 1 && events[0].data.fd == loop.FileDescriptor();
+		succeed &= read(loop.FileDescriptor(), &notifications, sizeof(notifications)) == sizeof(notifications);
+		succeed &= notifications == 1;
+		succeed &= loop.Drain() == 100 && count == 100 * (burst + 1);
+		succeed &= epoll_wait(epollFd, events, 2, 0) == 0;
+	}
+	count = 0;
+
+	// Bursts from several threads, every one wakes the loop at most once until it's drained
+	const int producerCount = 4;
+	const int emissionCount = 1000;
+	std::vector<std::thread> producers;
+	for (int p = 0; p < producerCount; ++p)
+	{
+		producers.push_back(std::thread([&loop, &received]()
+		{
+			for (int i = 0; i < emissionCount; ++i) loop.Emit(received, i, std::string("producer"));
+		}));
+	}
+
+	int wakeups = 0;
+	int messages = 0;
+	bool isPipeRead = false;
+	const int total = producerCount * emissionCount;
+	std::thread writer([&pipeFds]()
+	{
+		const char byte = 'x';
+		const ssize_t written = write(pipeFds[1], &byte, 1);
+		(void)written;
+	});
+
+	while ((count < total || !isPipeRead) && wakeups < 100000)
+	{
+		const int ready = epoll_wait(epollFd, events, 2, 1000);
+		for (int i = 0; i < ready; ++i)
+		{
+			if (events[i].data.fd == loop.FileDescriptor())
+			{
+				++wakeups;
+				messages += loop.Drain();
+			}
+			else
+			{
+				char byte = 0;
+				isPipeRead |= read(pipeFds[0], &byte, 1) == 1 && byte == 'x';
+			}
+		}
+		if (ready <= 0) break;
+	}
+
+	for (std::thread& producer : producers) producer.join();
+	writer.join();
+
+	succeed &= isPipeRead;
+	succeed &= count == total && messages == total;
+	printf("%d emissions drained in %d wakeups\n", messages, wakeups);
+
+	// Nothing left. A producer notifying while the last drain took the queue can leave a wakeup that
+	// finds nothing, after it the eventfd isn't readable anymore
+	succeed &= loop.Drain() == 0;
+	succeed &= epoll_wait(epollFd, &event, 1, 0) == 0;
+
+	close(epollFd);
+	close(pipeFds[0]);
+	close(pipeFds[1]);
+
+	assert(succeed && "[Event loop wakeups tests FAILED]");
+
+	printf("- END EVENT LOOP WAKEUPS TEST\n");
+	return succeed;
+}
+
+const bool EventLoopTestAsyncEmission()
+{
+	printf("+ INIT EVENT LOOP ASYNC EMISSION TEST\n");
+	bool succeed = true;
+
+	dc::CEventLoopExecutor loop;
+	dc::CSignal<int(int)> signal;
+	signal.ConnectOwned([](int value) { return value * 2; });
+	signal.ConnectOwned([](int value) { return value * 3; });
+
+	// The results are ready once the loop drains the slots
+	std::future<std::vector<int>> results = dc::EmitAsyncOn(loop, signal, 7);
+	succeed &= results.wait_for(std::chrono::milliseconds(0)) == std::future_status::timeout;
+
+	succeed &= loop.Drain() == 2;
+	succeed &= results.get() == std::vector<int>({ 14, 21 });
+	succeed &= loop.Drain() == 0;
+
+	assert(succeed && "[Event loop async emission tests FAILED]");
+
+	printf("- END EVENT LOOP ASYNC EMISSION TEST\n");
+	return succeed;
+}
+
+const bool EventLoopTestThrowingTask()
+{
+	printf("+ INIT EVENT LOOP THROWING TASK TEST\n");
+	bool succeed = true;
+
+	dc::CEventLoopExecutor loop;
+	std::string trace;
+	loop.Post([&trace]() { trace += "a"; });
+	loop.Post([&trace]() { trace += "b"; throw std::runtime_error("Task failed"); });
+	loop.Post([&trace]() { trace += "c"; });
+
+	bool hasThrown = false;
+	try
+	{
+		loop.Drain();
+	}
+	catch (const std::runtime_error& error)
+	{
+		hasThrown = true;
+	}
+	succeed &= hasThrown && trace == "ab";
+
+	// The task left is notified again and runs once, the ones that ran are gone
+	loop.Post([&trace]() { trace += "d"; });
+	uint64_t notifications = 0;
+	succeed &= read(loop.FileDescriptor(), &notifications, sizeof(notifications)) == sizeof(notifications);
+	succeed &= loop.Drain() == 2 && trace == "abcd";
+	succeed &= loop.Drain() == 0 && trace == "abcd";
+
+	assert(succeed && "[Event loop throwing task tests FAILED]");
+
+	printf("- END EVENT LOOP THROWING TASK TEST\n");
+	return succeed;
+}
+
+void TestDCEventLoop()
+{
+	printf("+++ TEST DC EVENT LOOP\n\n");
+
+	bool succeed = true;
+	succeed &= EventLoopTestWakeups();
+	succeed &= EventLoopTestAsyncEmission();
+	succeed &= EventLoopTestThrowingTask();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC EVENT LOOP\n");
+}
+
+#else
+
+void TestDCEventLoop()
+{
+	printf("+++ TEST DC EVENT LOOP\n\n");
+	printf("The event loop executor is only available in Linux\n");
+	printf("---END TEST DC EVENT LOOP\n");
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * instrumentation_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <signals/signal.h>
+
+const bool InstrumentationTestStats()
+{
+	printf("+ INIT INSTRUMENTATION TEST\n");
+	bool succeed = true;
+
+	TCountingFunctor functors[3];
+
+	dc::CSignal<void(const char*)> signal;
+	signal.SetName("test.instrumented");
+	for (TCountingFunctor& functor : functors)
+	{
+		signal.Connect(functor);
+	}
+
+	signal("First");
+	signal("Second");
+	signal.Disconnect(functors[0]);
+
+	succeed &= strcmp(signal.Name(), "test.instrumented") == 0;
+
+	const std::vector<dc::SSignalStats> snapshot = dc::CSignalStatsRegistry::Instance().Snapshot();
+	const dc::SSignalStats* stats = 0;
+	for (const dc::SSignalStats& signalStats : snapshot)
+	{
+		if (signalStats.mp_name && strcmp(signalStats.mp_name, "test.instrumented") == 0)
+		{
+			stats = &signalStats;
+		}
+	}
+
+#if defined(DCPP_SIGNALS_INSTRUMENTATION)
+	succeed &= stats != 0;
+	if (stats)
+	{
+		succeed &= stats->emitCount == 2;
+		succeed &= stats->slotCallCount == 6;
+		succeed &= stats->maxSlotCycles <= stats->slotCycles;
+		succeed &= stats->connectionsHighWater == 3;
+	}
+	dc::CSignalStatsRegistry::Instance().Dump(stdout, 5);
+#else
+	// Compiled out, nothing gets registered
+	succeed &= stats == 0;
+#endif
+
+	assert(succeed && "[Instrumentation tests FAILED]");
+
+	printf("- END INSTRUMENTATION TEST\n");
+	return succeed;
+}
+
+void TestDCInstrumentation()
+{
+	printf("+++ TEST DC INSTRUMENTATION\n\n");
+
+	bool succeed = InstrumentationTestStats();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC INSTRUMENTATION\n");
+}
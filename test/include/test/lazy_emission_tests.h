@@ -0,0 +1,96 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * lazy_emission_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+
+#include <signals/signal.h>
+
+const bool LazyEmissionTestFactories()
+{
+	printf("+ INIT LAZY EMISSION TEST\n");
+	bool succeed = true;
+
+	int builds = 0;
+	auto buildReport = [&builds]() { ++builds; return std::string("A report expensive to format"); };
+	auto buildLevel = [&builds]() { ++builds; return 3; };
+
+	// Nobody listens, nothing is built
+	dc::CSignal<void(const std::string&, int)> signal;
+	succeed &= !signal.EmitLazy(buildReport, buildLevel);
+	succeed &= builds == 0;
+
+	// Built once for all the slots
+	std::string received;
+	int levels = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		signal.ConnectOwned([&received, &levels](const std::string& report, int level)
+		{
+			received = report;
+			levels += level;
+		});
+	}
+	succeed &= signal.EmitLazy(buildReport, buildLevel);
+	succeed &= builds == 2;
+	succeed &= received == "A report expensive to format";
+	succeed &= levels == 12;
+
+	// Const signals too
+	const dc::CSignal<void(const std::string&, int)>& constSignal = signal;
+	succeed &= constSignal.EmitLazy(buildReport, buildLevel);
+	succeed &= builds == 4;
+
+	// A consumed one-shot connection doesn't count as a listener
+	TCountingFunctor functor;
+	dc::CSignal<void(const char*)> oneShot;
+	oneShot.ConnectOnce(functor);
+	int messages = 0;
+	auto buildMessage = [&messages]() { ++messages; return "Message"; };
+	succeed &= oneShot.EmitLazy(buildMessage);
+	succeed &= !oneShot.EmitLazy(buildMessage);
+	succeed &= messages == 1;
+	succeed &= functor.calls == 1;
+
+	assert(succeed && "[Lazy emission tests FAILED]");
+
+	printf("- END LAZY EMISSION TEST\n");
+	return succeed;
+}
+
+void TestDCLazyEmission()
+{
+	printf("+++ TEST DC LAZY EMISSION\n\n");
+
+	bool succeed = true;
+	succeed &= LazyEmissionTestFactories();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC LAZY EMISSION\n");
+}
@@ -0,0 +1,160 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * move_only_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <memory>
+#include <vector>
+
+#include <signals/signal.h>
+
+/*
+ Buffer handed over by a "buffer ready" event
+ */
+struct TBuffer
+{
+	explicit TBuffer(const int size) : data(size, 0) {}
+
+	std::vector<int> data;
+};
+
+/*
+ Counts the copies and the moves of its instances
+ */
+struct TCopyMoveCounter
+{
+	TCopyMoveCounter(int* copies, int* moves) : mp_copies(copies), mp_moves(moves) {}
+
+	TCopyMoveCounter(const TCopyMoveCounter& copy) : mp_copies(copy.mp_copies), mp_moves(copy.mp_moves) { ++*mp_copies; }
+
+	TCopyMoveCounter(TCopyMoveCounter&& moved) : mp_copies(moved.mp_copies), mp_moves(moved.mp_moves) { ++*mp_moves; }
+
+	int* mp_copies;
+	int* mp_moves;
+};
+
+/*
+ Keeps the buffers it's given
+ */
+struct TBufferSink
+{
+	void Take(std::unique_ptr<TBuffer> buffer) { buffers.push_back(std::move(buffer)); }
+
+	std::vector<std::unique_ptr<TBuffer>> buffers;
+};
+
+int g_observedSize = 0;
+
+void ObserveBufferSize(const std::unique_ptr<TBuffer>& buffer)
+{
+	g_observedSize = buffer ? buffer->data.size() : -1;
+}
+
+const bool MoveOnlyTestOwnershipTransfer()
+{
+	printf("+ INIT MOVE ONLY ARGUMENTS TEST\n");
+	bool succeed = true;
+
+	TBufferSink sink;
+	int observedSizes = 0;
+	auto observer = [&observedSizes](const std::unique_ptr<TBuffer>& buffer) { observedSizes += buffer ? buffer->data.size() : 0; };
+
+	// The sink is connected first but invoked the last, so the observers still see the buffer
+	dc::CSignal<void(std::unique_ptr<TBuffer>)> bufferReady;
+	bufferReady.Connect(&sink, &TBufferSink::Take);
+	bufferReady.ConnectObserver(observer);
+	bufferReady.ConnectObserver(&ObserveBufferSize);
+
+	bufferReady(std::unique_ptr<TBuffer>(new TBuffer(16)));
+	succeed &= sink.buffers.size() == 1 && sink.buffers[0]->data.size() == 16;
+	succeed &= observedSizes == 16;
+	succeed &= g_observedSize == 16;
+
+	// Without sink the buffer is released after the observers
+	dc::CSignal<void(std::unique_ptr<TBuffer>)> observed;
+	auto& connection = observed.ConnectObserver(observer);
+	observed(std::unique_ptr<TBuffer>(new TBuffer(4)));
+	succeed &= observedSizes == 20;
+
+	connection.Disconnect();
+	succeed &= observed.IsEmpty();
+
+	assert(succeed && "[Move only arguments tests FAILED]");
+
+	printf("- END MOVE ONLY ARGUMENTS TEST\n");
+	return succeed;
+}
+
+const bool MoveOnlyTestCopies()
+{
+	printf("+ INIT MOVE TO LAST SLOT TEST\n");
+	bool succeed = true;
+
+	int copies = 0;
+	int moves = 0;
+	int observations = 0;
+	auto byValue = [](TCopyMoveCounter counter) {};
+	auto observer = [&observations](const TCopyMoveCounter& counter) { ++observations; };
+
+	dc::CSignal<void(TCopyMoveCounter)> signal;
+	signal.Connect(byValue);
+	signal.Connect(byValue);
+	signal.Connect(byValue);
+	signal.ConnectObserver(observer);
+
+	// A copy for every slot but the last one, which gets it moved. Observers don't copy.
+	signal(TCopyMoveCounter(&copies, &moves));
+	succeed &= copies == 2;
+	succeed &= observations == 1;
+
+	// Only observers, no copies at all
+	copies = 0;
+	dc::CSignal<void(TCopyMoveCounter)> observed;
+	observed.ConnectObserver(observer);
+	observed.ConnectObserver(observer);
+	observed(TCopyMoveCounter(&copies, &moves));
+	succeed &= copies == 0;
+	succeed &= observations == 3;
+
+	assert(succeed && "[Move to last slot tests FAILED]");
+
+	printf("- END MOVE TO LAST SLOT TEST\n");
+	return succeed;
+}
+
+void TestDCMoveOnly()
+{
+	printf("+++ TEST DC MOVE ONLY ARGUMENTS\n\n");
+
+	bool succeed = true;
+	succeed &= MoveOnlyTestOwnershipTransfer();
+	succeed &= MoveOnlyTestCopies();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC MOVE ONLY ARGUMENTS\n");
+}
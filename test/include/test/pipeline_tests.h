@@ -0,0 +1,135 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * pipeline_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+
+#include <signals/signal.h>
+
+#include "allocation_tests.h"
+
+const bool PipelineTestOperators()
+{
+	printf("+ INIT PIPELINE OPERATORS TEST\n");
+	bool succeed = true;
+
+	dc::CSignal<void(int)> signal;
+
+	int sum = 0;
+	signal.Filter([](int value) { return value % 2 == 0; })
+		.Map([](int value) { return value * 10; })
+		.Take(2)
+		.Connect([&sum](int value) { sum += value; });
+
+	// A single connection whatever the number of operators
+	succeed &= signal.Count() == 1;
+
+	for (int i = 1; i <= 6; ++i) signal(i);
+	succeed &= sum == 20 + 40;
+
+	// Once Take is exhausted the operators before it aren't run anymore
+	dc::CSignal<void(int)> clicks;
+	int filtered = 0, taken = 0;
+	clicks.Filter([&filtered](int value) { ++filtered; return value > 0; })
+		.Take(2)
+		.Connect([&taken](int value) { ++taken; });
+
+	for (int i = 0; i < 10; ++i) clicks(i);
+	succeed &= taken == 2 && filtered == 3;
+
+	// Map joins the arguments in a single value for the next operators
+	dc::CSignal<void(int, const char*)> labeled;
+	std::string trace;
+	labeled.Map([](int value, const char* label) { return std::string(label) + std::to_string(value); })
+		.Filter([](const std::string& text) { return text.size() > 2; })
+		.Connect([&trace](const std::string& text) { trace += text + ";"; });
+
+	labeled(1, "a");
+	labeled(22, "b");
+	labeled(333, "c");
+	succeed &= trace == "b22;c333;";
+
+	// Pipelines are values, they can be branched before connecting them
+	dc::CSignal<void(int)> source;
+	int positives = 0, bigs = 0;
+	auto positive = source.Filter([](int value) { return value > 0; });
+	positive.Connect([&positives](int) { ++positives; });
+	positive.Filter([](int value) { return value > 100; }).Connect([&bigs](int) { ++bigs; });
+
+	source(-1);
+	source(5);
+	source(500);
+	succeed &= positives == 2 && bigs == 1 && source.Count() == 2;
+
+	assert(succeed && "[Pipeline operators tests FAILED]");
+
+	printf("- END PIPELINE OPERATORS TEST\n");
+	return succeed;
+}
+
+const bool PipelineTestConnection()
+{
+	printf("+ INIT PIPELINE CONNECTION TEST\n");
+	bool succeed = true;
+
+	dc::CSignal<void(int)> signal;
+
+	int calls = 0;
+	dc::CConnection<void(int)>& connection = signal.Take(3).Connect([&calls](int) { ++calls; });
+	signal(1);
+
+	// No allocation emitting through the pipeline
+	CAllocationCounter counter;
+	signal(2);
+	signal(3);
+	signal(4);
+	succeed &= counter.Count() == 0;
+	succeed &= calls == 3;
+
+	// The whole pipeline is disconnected through its connection
+	signal.Disconnect(connection);
+	succeed &= signal.Count() == 0;
+
+	assert(succeed && "[Pipeline connection tests FAILED]");
+
+	printf("- END PIPELINE CONNECTION TEST\n");
+	return succeed;
+}
+
+void TestDCPipelines()
+{
+	printf("+++ TEST DC PIPELINES\n\n");
+
+	bool succeed = true;
+	succeed &= PipelineTestOperators();
+	succeed &= PipelineTestConnection();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC PIPELINES\n");
+}
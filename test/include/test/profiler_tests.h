@@ -0,0 +1,104 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * profiler_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <chrono>
+
+#include <signals/signal.h>
+
+struct TSlowFunctor
+{
+public:
+	void operator()(const char* message)
+	{
+		// Busy waiting, so it takes the same time with any scheduler
+		const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+		while (std::chrono::steady_clock::now() < end)
+		{
+		}
+	}
+};
+
+const bool ProfilerTestSlowSlots()
+{
+	printf("+ INIT SLOT PROFILER TEST\n");
+	bool succeed = true;
+
+	TCountingFunctor fastFunctor;
+	TSlowFunctor slowFunctor;
+
+	dc::CSignal<void(const char*)> signal;
+	signal.SetName("test.profiled");
+	signal.Connect(fastFunctor);
+	signal.Connect(slowFunctor);
+	signal.Connect(&FreeFunctionPrintString);
+
+	succeed &= signal.Profiler() == 0;
+
+	// Sampling one emission out of four
+	signal.EnableProfiling(4, 1000000);
+	for (int i = 0; i < 20; ++i)
+	{
+		signal("Profiled emission");
+	}
+
+	const dc::CSlotProfiler* profiler = signal.Profiler();
+	succeed &= profiler != 0 && fastFunctor.calls == 20;
+
+	const std::vector<dc::SSlotProfile> profiles = profiler->Profiles();
+	succeed &= profiles.size() == 3;
+	for (const dc::SSlotProfile& profile : profiles)
+	{
+		succeed &= profile.callCount == 5;
+		succeed &= profile.mp_function != 0;
+	}
+
+	const std::vector<dc::SSlotProfile> slowSlots = profiler->SlowSlots();
+	succeed &= slowSlots.size() == 1;
+	succeed &= !slowSlots.empty() && slowSlots[0].mp_object == &slowFunctor;
+	profiler->Report(stdout, signal.Name());
+
+	signal.DisableProfiling();
+	succeed &= signal.Profiler() == 0;
+
+	assert(succeed && "[Slot profiler tests FAILED]");
+
+	printf("- END SLOT PROFILER TEST\n");
+	return succeed;
+}
+
+void TestDCProfiler()
+{
+	printf("+++ TEST DC SLOT PROFILER\n\n");
+
+	bool succeed = ProfilerTestSlowSlots();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC SLOT PROFILER\n");
+}
@@ -0,0 +1,222 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * relay_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+
+#include <signals/signal.h>
+
+#include "allocation_tests.h"
+
+/*
+ Appends its tag to the trace of the slots invoked
+ */
+struct TTraceSlot
+{
+	TTraceSlot(std::string* trace, const char tag) : mp_trace(trace), m_tag(tag) {}
+
+	void operator()(int value) { mp_trace->push_back(m_tag); }
+
+	std::string*	mp_trace;
+	char			m_tag;
+};
+
+/*
+ Connects the slot to the signal several times on its first call
+ */
+struct TConnectingSlot
+{
+	TConnectingSlot(dc::CSignal<void(int)>* signal, TTraceSlot* slot) : mp_signal(signal), mp_slot(slot), m_isDone(false) {}
+
+	void operator()(int value)
+	{
+		if (m_isDone) return;
+
+		m_isDone = true;
+		for (unsigned i = 0; i < 32; ++i)
+		{
+			mp_signal->Connect(*mp_slot);
+		}
+	}
+
+	dc::CSignal<void(int)>*	mp_signal;
+	TTraceSlot*				mp_slot;
+	bool					m_isDone;
+};
+
+const bool RelayTestChain()
+{
+	printf("+ INIT RELAY CHAIN TEST\n");
+	bool succeed = true;
+
+	std::string trace;
+	TTraceSlot a(&trace, 'a'), b(&trace, 'b'), c(&trace, 'c'), d(&trace, 'd');
+
+	// module -> layer -> application, with slots at every level
+	dc::CSignal<void(int)> module;
+	dc::CSignal<void(int)> layer;
+	dc::CSignal<void(int)> application;
+	module.Connect(a);
+	module.ConnectSignal(layer);
+	module.Connect(d);
+	layer.Connect(b);
+	layer.ConnectSignal(application);
+	application.Connect(c);
+
+	// Same order than the nested emissions
+	module(1);
+	succeed &= trace == "abcd";
+
+	// Changes down the chain reach the emissions up
+	TTraceSlot e(&trace, 'e');
+	application.Connect(e);
+	trace.clear();
+	module(2);
+	succeed &= trace == "abced";
+
+	layer.Disconnect(b);
+	trace.clear();
+	module(3);
+	succeed &= trace == "aced";
+
+	// Emitting the middle of the chain
+	trace.clear();
+	layer(4);
+	succeed &= trace == "ce";
+
+	// One-shot connections down the chain are consumed once
+	TTraceSlot f(&trace, 'f');
+	application.ConnectOnce(f);
+	trace.clear();
+	module(5);
+	module(6);
+	succeed &= trace == "acefdaced";
+
+	// Disconnecting the relay
+	module.DisconnectSignal(layer);
+	trace.clear();
+	module(7);
+	succeed &= trace == "ad";
+
+	assert(succeed && "[Relay chain tests FAILED]");
+
+	printf("- END RELAY CHAIN TEST\n");
+	return succeed;
+}
+
+const bool RelayTestLifetime()
+{
+	printf("+ INIT RELAY LIFETIME TEST\n");
+	bool succeed = true;
+
+	std::string trace;
+	TTraceSlot a(&trace, 'a'), b(&trace, 'b');
+
+	dc::CSignal<void(int)> source;
+	source.Connect(a);
+	{
+		// Destroying the target removes the relay
+		dc::CSignal<void(int)> target;
+		target.Connect(b);
+		source.ConnectSignal(target);
+		source(1);
+		succeed &= source.Count() == 2;
+	}
+	succeed &= source.Count() == 1;
+	source(2);
+	succeed &= trace == "aba";
+
+	// Copies of the source forward too, and moving the target keeps the relays
+	dc::CSignal<void(int)> target;
+	target.Connect(b);
+	source.ConnectSignal(target);
+	dc::CSignal<void(int)> copy(source);
+
+	dc::CSignal<void(int)> moved(std::move(target));
+	trace.clear();
+	source(3);
+	copy(4);
+	succeed &= trace == "abab";
+
+	// No allocation once the chain is flattened
+	source(5);
+	CAllocationCounter counter;
+	source(6);
+	succeed &= counter.Count() == 0;
+
+	assert(succeed && "[Relay lifetime tests FAILED]");
+
+	printf("- END RELAY LIFETIME TEST\n");
+	return succeed;
+}
+
+const bool RelayTestConnectingSlot()
+{
+	printf("+ INIT RELAY CONNECTING SLOT TEST\n");
+	bool succeed = true;
+
+	std::string trace;
+	TTraceSlot a(&trace, 'a'), c(&trace, 'c'), x(&trace, 'x');
+
+	// The slot in the middle grows the connections of the end of the chain while it is emitted
+	dc::CSignal<void(int)> module;
+	dc::CSignal<void(int)> layer;
+	dc::CSignal<void(int)> application;
+	TConnectingSlot connecting(&application, &x);
+	module.Connect(a);
+	module.ConnectSignal(layer);
+	layer.Connect(connecting);
+	layer.ConnectSignal(application);
+	application.Connect(c);
+
+	module(1);
+	succeed &= trace == "ac";
+
+	trace.clear();
+	module(2);
+	succeed &= trace == "ac" + std::string(32, 'x');
+
+	assert(succeed && "[Relay connecting slot tests FAILED]");
+
+	printf("- END RELAY CONNECTING SLOT TEST\n");
+	return succeed;
+}
+
+void TestDCRelays()
+{
+	printf("+++ TEST DC RELAYS\n\n");
+
+	bool succeed = true;
+	succeed &= RelayTestChain();
+	succeed &= RelayTestLifetime();
+	succeed &= RelayTestConnectingSlot();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC RELAYS\n");
+}
@@ -0,0 +1,124 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * replay_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <signals/replay_signal.h>
+
+#include "allocation_tests.h"
+
+const bool ReplayTestHistory()
+{
+	printf("+ INIT REPLAY HISTORY TEST\n");
+	bool succeed = true;
+
+	// Behavior subject: late slots receive the last value. The emissions without slots are recorded too
+	dc::CReplaySignal<void(const std::string&)> configLoaded;
+	succeed &= !configLoaded("defaults.cfg");
+	succeed &= !configLoaded("user.cfg");
+
+	std::string loaded;
+	configLoaded.ConnectOwned([&loaded](const std::string& path) { loaded = path; });
+	succeed &= loaded == "user.cfg";
+
+	succeed &= configLoaded("project.cfg");
+	succeed &= loaded == "project.cfg";
+
+	// Bigger histories are replayed oldest first
+	dc::CReplaySignal<void(int, char), 3> signal;
+	for (int i = 1; i <= 5; ++i) signal(i, 'a' + i);
+	succeed &= signal.HistoryCount() == 3;
+
+	std::vector<int> values;
+	std::string tags;
+	signal.ConnectOwned([&](int value, char tag) { values.push_back(value); tags.push_back(tag); });
+	succeed &= values == std::vector<int>({ 3, 4, 5 });
+	succeed &= tags == "def";
+
+	// Only the new slot gets the replay
+	TCountingFunctor counter;
+	dc::CReplaySignal<void(const char*), 2> messages;
+	messages("first");
+	messages.Connect(counter);
+	succeed &= counter.calls == 1;
+	TCountingFunctor other;
+	messages.Connect(other);
+	succeed &= counter.calls == 1 && other.calls == 1;
+	messages("second");
+	succeed &= counter.calls == 2;
+
+	// Nothing is replayed after clearing the history
+	messages.ClearHistory();
+	TCountingFunctor late;
+	messages.Connect(late);
+	succeed &= late.calls == 0 && messages.Count() == 3;
+
+	assert(succeed && "[Replay history tests FAILED]");
+
+	printf("- END REPLAY HISTORY TEST\n");
+	return succeed;
+}
+
+const bool ReplayTestAllocations()
+{
+	printf("+ INIT REPLAY ALLOCATIONS TEST\n");
+	bool succeed = true;
+
+	dc::CReplaySignal<void(int, float), 4> signal;
+
+	int sum = 0;
+	signal.ConnectOwned([&sum](int value, float) { sum += value; });
+
+	// Warming up the ring
+	for (int i = 0; i < 4; ++i) signal(i, 0.5f);
+
+	CAllocationCounter counter;
+	for (int i = 0; i < 100; ++i) signal(i, 0.5f);
+	succeed &= counter.Count() == 0;
+	succeed &= sum == 6 + 4950;
+
+	assert(succeed && "[Replay allocations tests FAILED]");
+
+	printf("- END REPLAY ALLOCATIONS TEST\n");
+	return succeed;
+}
+
+void TestDCReplay()
+{
+	printf("+++ TEST DC REPLAY\n\n");
+
+	bool succeed = true;
+	succeed &= ReplayTestHistory();
+	succeed &= ReplayTestAllocations();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC REPLAY\n");
+}
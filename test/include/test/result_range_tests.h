@@ -0,0 +1,157 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * result_range_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <signals/signal.h>
+
+#include "allocation_tests.h"
+
+/*
+ Handler of the files with an extension, counting how many times it's asked
+ */
+struct TFileHandler
+{
+	explicit TFileHandler(const char* extension) : mp_extension(extension), calls(0) {}
+
+	const bool Handles(const std::string& path)
+	{
+		++calls;
+		const std::string extension(mp_extension);
+		return path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+	}
+
+	const char* mp_extension;
+	int calls;
+};
+
+const bool ResultRangeTestFirstHandler()
+{
+	printf("+ INIT RESULT RANGE FIRST HANDLER TEST\n");
+	bool succeed = true;
+
+	TFileHandler handlers[] = { TFileHandler(".png"), TFileHandler(".txt"), TFileHandler(".wav"), TFileHandler(".json") };
+
+	dc::CSignal<const bool(const std::string&)> handles;
+	for (TFileHandler& handler : handlers)
+	{
+		handles.Connect(&handler, &TFileHandler::Handles);
+	}
+
+	// Stopping at the first handler, the ones after it are never invoked
+	int position = 0;
+	for (const bool isHandled : handles.Results("notes.txt"))
+	{
+		if (isHandled) break;
+		++position;
+	}
+	succeed &= position == 1;
+	succeed &= handlers[0].calls == 1 && handlers[1].calls == 1;
+	succeed &= handlers[2].calls == 0 && handlers[3].calls == 0;
+
+	// Positions not dereferenced are skipped without invoking them
+	auto results = handles.Results("song.wav");
+	auto it = results.begin();
+	++it;
+	++it;
+	succeed &= *it;
+	succeed &= *it;
+	succeed &= handlers[1].calls == 1 && handlers[2].calls == 1;
+
+	++it;
+	++it;
+	succeed &= it == results.end();
+
+	assert(succeed && "[Result range first handler tests FAILED]");
+
+	printf("- END RESULT RANGE FIRST HANDLER TEST\n");
+	return succeed;
+}
+
+int ResultRangeSquare(int value) { return value * value; }
+
+const bool ResultRangeTestValues()
+{
+	printf("+ INIT RESULT RANGE VALUES TEST\n");
+	bool succeed = true;
+
+	dc::CSignal<int(int)> signal;
+	signal.Connect(&ResultRangeSquare);
+	signal.ConnectOwned([](int value) { return value + 1; });
+	signal.ConnectOnce(&ResultRangeSquare);
+
+	// Same values and order than the array overload
+	std::vector<int> values;
+	for (const int value : signal.Results(3))
+	{
+		values.push_back(value);
+	}
+	succeed &= values.size() == 3;
+	succeed &= values[0] == 9 && values[1] == 4 && values[2] == 9;
+
+	// The one-shot connection was consumed by the iteration
+	succeed &= signal.Count() == 2;
+	int array[2];
+	signal(array, 2);
+	succeed &= array[0] == 4 && array[1] == 3;
+
+	// No buffer for the results
+	CAllocationCounter counter;
+	int sum = 0;
+	for (const int value : signal.Results(4))
+	{
+		sum += value;
+	}
+	succeed &= sum == 21;
+	succeed &= counter.Count() == 0;
+
+	// Nothing connected
+	dc::CSignal<int(int)> empty;
+	auto emptyResults = empty.Results(1);
+	succeed &= emptyResults.begin() == emptyResults.end();
+
+	assert(succeed && "[Result range values tests FAILED]");
+
+	printf("- END RESULT RANGE VALUES TEST\n");
+	return succeed;
+}
+
+void TestDCResultRange()
+{
+	printf("+++ TEST DC RESULT RANGE\n\n");
+
+	bool succeed = true;
+	succeed &= ResultRangeTestFirstHandler();
+	succeed &= ResultRangeTestValues();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC RESULT RANGE\n");
+}
@@ -0,0 +1,179 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * shared_signal_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <chrono>
+#include <thread>
+
+#include <signals/shared_signal.h>
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+struct TKeyEvent
+{
+	int		code;
+	bool	isPressed;
+};
+
+using TKeySignature = void(const TKeyEvent&, double);
+
+const std::string SharedSegmentName(const char* suffix)
+{
+	return "/dcpp_signals_" + std::to_string(getpid()) + suffix;
+}
+
+const bool SharedSignalTestRing()
+{
+	printf("+ INIT SHARED SIGNAL RING TEST\n");
+	bool succeed = true;
+
+	const std::string name = SharedSegmentName("_ring");
+	dc::CSharedSignalPublisher<TKeySignature> publisher(name.c_str(), 8);
+	succeed &= publisher.IsOpen();
+
+	// Nothing published before subscribing is received
+	publisher(TKeyEvent{ 1, true }, 0.5);
+
+	dc::CSharedSignalSubscriber<TKeySignature> subscriber(name.c_str());
+	succeed &= subscriber.IsOpen() && publisher.SubscriberCount() == 1;
+
+	int codes = 0;
+	double time = 0.0;
+	subscriber.ConnectOwned([&](const TKeyEvent& event, double timestamp) { codes = codes * 10 + event.code; time += timestamp; });
+
+	publisher(TKeyEvent{ 2, true }, 1.0);
+	publisher(TKeyEvent{ 3, false }, 2.0);
+	succeed &= subscriber.Dispatch() == 2;
+	succeed &= codes == 23 && time == 3.0;
+	succeed &= subscriber.Dispatch() == 0;
+
+	// Falling behind the capacity loses the oldest emissions
+	codes = 0;
+	for (int i = 0; i < 20; ++i) publisher(TKeyEvent{ i % 10, true }, 0.0);
+	succeed &= subscriber.Dispatch() == 7;
+	succeed &= subscriber.LostCount() == 13;
+	succeed &= codes == 3456789;
+
+	// Only segments of the same signature can be opened
+	dc::CSharedSignalSubscriber<void(int)> other(name.c_str());
+	dc::CSharedSignalSubscriber<TKeySignature> missing("/dcpp_signals_missing");
+	succeed &= !other.IsOpen() && !missing.IsOpen();
+
+	// The segment of a publisher isn't taken by another one
+	dc::CSharedSignalPublisher<TKeySignature> duplicated(name.c_str(), 8);
+	succeed &= !duplicated.IsOpen();
+
+	// Until it's removed, like the ones left by the publishers that crashed
+	const std::string staleName = SharedSegmentName("_stale");
+	const int stale = shm_open(staleName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+	succeed &= stale >= 0 && close(stale) == 0;
+	succeed &= !dc::CSharedSignalPublisher<void(int)>(staleName.c_str()).IsOpen();
+	succeed &= dc::RemoveSharedSignal(staleName.c_str());
+	succeed &= dc::CSharedSignalPublisher<void(int)>(staleName.c_str()).IsOpen();
+	succeed &= !dc::RemoveSharedSignal(staleName.c_str());
+
+	assert(succeed && "[Shared signal ring tests FAILED]");
+
+	printf("- END SHARED SIGNAL RING TEST\n");
+	return succeed;
+}
+
+const bool SharedSignalTestProcesses()
+{
+	printf("+ INIT SHARED SIGNAL PROCESSES TEST\n");
+	bool succeed = true;
+
+	const std::string name = SharedSegmentName("_processes");
+	dc::CSharedSignalPublisher<void(int)> publisher(name.c_str(), 4096);
+
+	// Subscribing before forking, the child only waits and emits
+	int received = 0;
+	long long sum = 0;
+	dc::CSharedSignalSubscriber<void(int)> subscriber(name.c_str());
+	subscriber.ConnectOwned([&](int value) { ++received; sum += value; });
+
+	// The test runs before any other starts threads, the child of a process with threads running could only
+	// call async-signal-safe functions
+	const int count = 1000;
+	const pid_t child = fork();
+	if (child == 0)
+	{
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		while (received < count && std::chrono::steady_clock::now() < deadline)
+		{
+			subscriber.Wait(std::chrono::milliseconds(100));
+		}
+		_exit(received == count && sum == (long long)count * (count - 1) / 2 ? 0 : 1);
+	}
+
+	// Giving the child the time to sleep in the futex
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	for (int i = 0; i < count; ++i) publisher(i);
+
+	int status = 0;
+	succeed &= child > 0 && waitpid(child, &status, 0) == child;
+	succeed &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+	// The parent's copy of the subscriber sees the same emissions
+	succeed &= subscriber.Dispatch() == count && received == count;
+
+	assert(succeed && "[Shared signal processes tests FAILED]");
+
+	printf("- END SHARED SIGNAL PROCESSES TEST\n");
+	return succeed;
+}
+
+void TestDCSharedSignals()
+{
+	printf("+++ TEST DC SHARED SIGNALS\n\n");
+
+	bool succeed = true;
+	succeed &= SharedSignalTestRing();
+	succeed &= SharedSignalTestProcesses();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC SHARED SIGNALS\n");
+}
+
+#else
+
+void TestDCSharedSignals()
+{
+	printf("+++ TEST DC SHARED SIGNALS\n\n");
+	printf("Shared signals are only available in Linux\n");
+	printf("---END TEST DC SHARED SIGNALS\n");
+}
+
+#endif
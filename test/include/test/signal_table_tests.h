@@ -0,0 +1,173 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * signal_table_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <signals/signal_table.h>
+
+enum class EInputEvent
+{
+	Press,
+	Release,
+	Move,
+	Count
+};
+
+class CInputListener
+{
+public:
+	CInputListener(): presses(0), releases(0) {}
+
+public:
+	void OnPress(const int button) { ++presses; }
+
+	void OnRelease(const int button) { ++releases; }
+
+public:
+	int presses;
+	int releases;
+};
+
+const int DoubleButton(const int button)
+{
+	return button * 2;
+}
+
+const bool SignalTableTestConnections()
+{
+	printf("+ INIT SIGNAL TABLE TEST\n");
+	bool succeed = true;
+
+	CInputListener listener;
+	dc::CSignalTable<EInputEvent, void(const int)> table;
+
+	table.Connect(EInputEvent::Release, &listener, &CInputListener::OnRelease);
+	auto connection = table.Connect(EInputEvent::Press, &listener, &CInputListener::OnPress);
+	table.Connect(EInputEvent::Release, &listener, &CInputListener::OnRelease);
+
+	succeed &= table.Count() == 3;
+	succeed &= table.Count(EInputEvent::Press) == 1 && table.Count(EInputEvent::Release) == 2;
+	succeed &= table.IsEmpty(EInputEvent::Move);
+
+	succeed &= table(EInputEvent::Press, 1);
+	succeed &= table(EInputEvent::Release, 1);
+	succeed &= table(EInputEvent::Move, 1);
+	succeed &= listener.presses == 1 && listener.releases == 2;
+
+	table.Disconnect(EInputEvent::Press, connection);
+	table.Disconnect(EInputEvent::Release, &listener, &CInputListener::OnRelease);
+	succeed &= table.Count(EInputEvent::Press) == 0 && table.Count(EInputEvent::Release) == 1;
+
+	table(EInputEvent::Press, 1);
+	table(EInputEvent::Release, 1);
+	succeed &= listener.presses == 1 && listener.releases == 3;
+
+	// Tables are movable, the connections keep working after the move
+	dc::CSignalTable<EInputEvent, void(const int)> movedTable(std::move(table));
+	movedTable(EInputEvent::Release, 1);
+	succeed &= listener.releases == 4 && table.IsEmpty();
+
+	movedTable.Clear(EInputEvent::Release);
+	succeed &= movedTable.IsEmpty();
+
+	// Recovering values from the connections of one key
+	dc::CSignalTable<EInputEvent, const int(const int)> valuesTable;
+	valuesTable.Connect(EInputEvent::Move, &DoubleButton);
+	valuesTable.Connect(EInputEvent::Move, &DoubleButton);
+
+	int values[2] = { 0, 0 };
+	succeed &= valuesTable(EInputEvent::Move, values, 3);
+	succeed &= values[0] == 6 && values[1] == 6;
+
+	assert(succeed && "[Signal table tests FAILED]");
+
+	printf("- END SIGNAL TABLE TEST\n");
+	return succeed;
+}
+
+/*
+ Connects the listener to the presses of the table several times on its first call
+ */
+struct TConnectingListener
+{
+	TConnectingListener(dc::CSignalTable<EInputEvent, void(const int)>* table, CInputListener* listener) :
+		mp_table(table), mp_listener(listener), m_isDone(false) {}
+
+	void operator()(const int button)
+	{
+		if (m_isDone) return;
+
+		m_isDone = true;
+		for (unsigned i = 0; i < 32; ++i)
+		{
+			mp_table->Connect(EInputEvent::Press, mp_listener, &CInputListener::OnPress);
+		}
+	}
+
+	dc::CSignalTable<EInputEvent, void(const int)>*	mp_table;
+	CInputListener*									mp_listener;
+	bool											m_isDone;
+};
+
+const bool SignalTableTestConnectingSlot()
+{
+	printf("+ INIT SIGNAL TABLE CONNECTING SLOT TEST\n");
+	bool succeed = true;
+
+	CInputListener listener;
+	dc::CSignalTable<EInputEvent, void(const int)> table;
+
+	// The connections of the presses go before the releases, so the slot moves the ones being emitted
+	TConnectingListener connecting(&table, &listener);
+	table.Connect(EInputEvent::Release, connecting);
+	table.Connect(EInputEvent::Release, &listener, &CInputListener::OnRelease);
+
+	succeed &= table(EInputEvent::Release, 1);
+	succeed &= listener.releases == 1 && listener.presses == 0;
+	succeed &= table.Count(EInputEvent::Press) == 32 && table.Count(EInputEvent::Release) == 2;
+
+	table(EInputEvent::Press, 1);
+	succeed &= listener.presses == 32;
+
+	assert(succeed && "[Signal table connecting slot tests FAILED]");
+
+	printf("- END SIGNAL TABLE CONNECTING SLOT TEST\n");
+	return succeed;
+}
+
+void TestDCSignalTable()
+{
+	printf("+++ TEST DC SIGNAL TABLE\n\n");
+
+	bool succeed = SignalTableTestConnections();
+	succeed &= SignalTableTestConnectingSlot();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC SIGNAL TABLE\n");
+}
@@ -24,6 +24,8 @@
 #include <assert.h>
 #include <stdio.h>
 #include <string>
+#include <vector>
+#include <type_traits>
 
 #include <signals/signal.h>
 
@@ -47,6 +49,21 @@ public:
 	}
 };
 
+struct TCountingFunctor
+{
+public:
+	TCountingFunctor(): calls(0) {}
+
+public:
+	void operator()(const char* message)
+	{
+		++calls;
+	}
+
+public:
+	int calls;
+};
+
 class Foo
 {
 public:
@@ -660,6 +677,193 @@ const bool TestSignalCopy()
 	return true;
 }
 
+const bool SignalTestConnectOnce()
+{
+	printf("+ INIT ONE-SHOT CONNECTIONS TEST\n");
+	bool succeed = true;
+
+	TCountingFunctor persistent;
+	TCountingFunctor oneShots[3];
+
+	dc::CSignal<void(const char*)> signal;
+	signal.ConnectOnce(oneShots[0]);
+	signal.Connect(persistent);
+	signal.ConnectOnce(oneShots[1]);
+	signal.ConnectOnce(oneShots[2]);
+	succeed &= signal.Count() == 4;
+
+	succeed &= signal("First emission");
+	succeed &= signal.Count() == 1;
+
+	succeed &= signal("Second emission");
+	succeed &= persistent.calls == 2;
+	for (const TCountingFunctor& oneShot : oneShots)
+	{
+		succeed &= oneShot.calls == 1;
+	}
+
+	// Const emissions consume them too, the removal waits until the signal can be modified
+	const dc::CSignal<void(const char*)>& constSignal = signal;
+	auto connection = signal.ConnectOnce(oneShots[0]);
+	succeed &= constSignal("Const emission");
+	succeed &= constSignal("Const emission");
+	succeed &= signal.Count() == 1 && oneShots[0].calls == 2;
+
+	// Disconnecting an already consumed connection is harmless
+	connection.Disconnect();
+	succeed &= signal.Count() == 1;
+
+	assert(succeed && "[One-shot connections tests FAILED]");
+
+	printf("- END ONE-SHOT CONNECTIONS TEST\n");
+	return succeed;
+}
+
+/*
+ One-shot slot emitting its own signal again, the inner emission runs while the outer one is still iterating
+ */
+struct TReentrantSlot
+{
+	TReentrantSlot(dc::CSignal<void(int)>* signal) : mp_signal(signal), calls(0) {}
+
+	void operator()(int depth)
+	{
+		++calls;
+		if (depth > 0) (*mp_signal)(depth - 1);
+	}
+
+	dc::CSignal<void(int)>*	mp_signal;
+	int						calls;
+};
+
+const bool SignalTestReentrantOneShot()
+{
+	printf("+ INIT REENTRANT ONE-SHOT TEST\n");
+	bool succeed = true;
+
+	dc::CSignal<void(int)> signal;
+	TReentrantSlot reentrant(&signal);
+	std::vector<TReentrantSlot> oneShots(8, TReentrantSlot(&signal));
+	signal.ConnectOnce(reentrant);
+	for (TReentrantSlot& oneShot : oneShots) signal.ConnectOnce(oneShot);
+	signal.Connect(reentrant);
+
+	// The consumed connections are removed when the outermost emission returns
+	signal(3);
+	succeed &= signal.Count() == 1;
+	for (const TReentrantSlot& oneShot : oneShots) succeed &= oneShot.calls == 1;
+
+	// Same with the array emissions
+	dc::CSignal<int(int)> values;
+	int calls = 0;
+	std::function<int(int)> emitter = [&](int depth)
+	{
+		int inner[2];
+		if (depth > 0) values(inner, depth - 1);
+		return ++calls;
+	};
+	std::function<int(int)> counter = [&calls](int) { return ++calls; };
+	values.ConnectOnce(emitter);
+	values.ConnectOnce(counter);
+	values.Connect(counter);
+
+	int results[3];
+	values(results, 2);
+	succeed &= values.Count() == 1;
+	succeed &= results[0] == 3;
+
+	assert(succeed && "[Reentrant one-shot tests FAILED]");
+
+	printf("- END REENTRANT ONE-SHOT TEST\n");
+	return succeed;
+}
+
+const bool SignalTestMoveInContainers()
+{
+	printf("+ INIT SIGNALS IN CONTAINERS TEST\n");
+	bool succeed = true;
+
+	using TSignal = dc::CSignal<void(const char*)>;
+	static_assert(std::is_nothrow_move_constructible<TSignal>::value, "Signals should be nothrow movable");
+
+	TCountingFunctor functor;
+	std::vector<TSignal> signals(1);
+	auto connection = signals[0].Connect(functor);
+
+	// Forcing several reallocations, the first signal is moved each time
+	for (int i = 0; i < 64; ++i)
+	{
+		signals.push_back(TSignal());
+		signals.back().Connect(functor);
+	}
+
+	succeed &= signals[0]("Moved signal");
+	succeed &= functor.calls == 1;
+
+	// The connection still knows where its signal lives
+	succeed &= connection.IsConnected();
+	connection.Disconnect();
+	succeed &= signals[0].IsEmpty() && signals[1].Count() == 1;
+
+	// Copies get their own connections, bound to the copy
+	TSignal copy = signals[1];
+	auto copyConnection = copy.Connect(&FreeFunctionPrintString);
+	copyConnection.Disconnect();
+	succeed &= copy.Count() == 1 && signals[1].Count() == 1;
+
+	assert(succeed && "[Signals in containers tests FAILED]");
+
+	printf("- END SIGNALS IN CONTAINERS TEST\n");
+	return succeed;
+}
+
+const bool SignalTestMemoryFootprint()
+{
+	printf("+ INIT MEMORY FOOTPRINT TEST\n");
+	bool succeed = true;
+
+	using TSignal = dc::CSignal<void(const char*)>;
+	const std::size_t initialHeapBytes = dc::CSignalMemory::HeapBytes();
+
+	TCountingFunctor functors[100];
+	{
+		TSignal signal;
+		succeed &= signal.MemoryUsage().Heap() == 0 && signal.Capacity() == 0;
+
+		// Reserving before the bulk of connections
+		signal.Reserve(100);
+		const unsigned capacity = signal.Capacity();
+		for (TCountingFunctor& functor : functors)
+		{
+			signal.Connect(functor);
+		}
+		succeed &= capacity >= 100 && signal.Capacity() == capacity;
+
+		const dc::SSignalMemoryUsage usage = signal.MemoryUsage();
+		succeed &= usage.signal == sizeof(TSignal);
+		succeed &= usage.connections == capacity * sizeof(TSignal::TConnection);
+		succeed &= usage.Total() == usage.signal + usage.connections + usage.binding + usage.callables;
+		succeed &= dc::CSignalMemory::HeapBytes() == initialHeapBytes + usage.Heap();
+
+		// Trimming after disconnecting most of them
+		for (int i = 0; i < 90; ++i)
+		{
+			signal.Disconnect(functors[i]);
+		}
+		signal.ShrinkToFit();
+		succeed &= signal.Capacity() == 10;
+		succeed &= dc::CSignalMemory::HeapBytes() == initialHeapBytes + signal.MemoryUsage().Heap();
+	}
+
+	// Destroyed signals give their memory back
+	succeed &= dc::CSignalMemory::HeapBytes() == initialHeapBytes;
+
+	assert(succeed && "[Memory footprint tests FAILED]");
+
+	printf("- END MEMORY FOOTPRINT TEST\n");
+	return succeed;
+}
+
 void TestDCSignal()
 {
 	printf("+++ TEST DC SIGNAL\n\n");
@@ -676,6 +880,11 @@ void TestDCSignal()
 	succeed &= SimpleTestHowToRecoverValues();
 
 	succeed &= SimpleSignalTests();
+
+	succeed &= SignalTestConnectOnce();
+	succeed &= SignalTestReentrantOneShot();
+	succeed &= SignalTestMoveInContainers();
+	succeed &= SignalTestMemoryFootprint();
 	
 	if(succeed)
 	{
@@ -0,0 +1,260 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * slab_allocator_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <signals/signal.h>
+
+const bool SlabAllocatorTestBlocks()
+{
+	printf("+ INIT SLAB ALLOCATOR BLOCKS TEST\n");
+	bool succeed = true;
+
+	// Freed blocks are the first ones reused by the thread
+	void* first = dc::CSlabAllocator::Allocate(40);
+	dc::CSlabAllocator::Deallocate(first, 40);
+	void* second = dc::CSlabAllocator::Allocate(48);
+	succeed &= first == second;
+
+	// Blocks of the same size class don't overlap
+	void* third = dc::CSlabAllocator::Allocate(48);
+	const char* secondBytes = static_cast<const char*>(second);
+	const char* thirdBytes = static_cast<const char*>(third);
+	succeed &= thirdBytes + 48 <= secondBytes || secondBytes + 48 <= thirdBytes;
+	succeed &= reinterpret_cast<std::size_t>(third) % dc::CSlabAllocator::kGranularity == 0;
+
+	dc::CSlabAllocator::Deallocate(second, 48);
+	dc::CSlabAllocator::Deallocate(third, 48);
+
+	// Big blocks are served by the global operator new
+	void* big = dc::CSlabAllocator::Allocate(dc::CSlabAllocator::kMaxBlockSize + 1);
+	succeed &= big != 0;
+	dc::CSlabAllocator::Deallocate(big, dc::CSlabAllocator::kMaxBlockSize + 1);
+
+	assert(succeed && "[Slab allocator blocks tests FAILED]");
+
+	printf("- END SLAB ALLOCATOR BLOCKS TEST\n");
+	return succeed;
+}
+
+const bool SlabAllocatorTestThreads()
+{
+	printf("+ INIT SLAB ALLOCATOR THREADS TEST\n");
+	bool succeed = true;
+
+	// Every thread connects owned slots to its own signals and frees the blocks of the others
+	const unsigned threadCount = 4;
+	std::vector<dc::CSignal<void(int)>> signals(threadCount);
+	std::vector<int> sums(threadCount, 0);
+
+	std::vector<std::thread> threads;
+	for (unsigned i = 0; i < threadCount; ++i)
+	{
+		threads.push_back(std::thread([&signals, &sums, i]()
+		{
+			int& sum = sums[i];
+			for (int j = 0; j < 1000; ++j)
+			{
+				signals[i].ConnectOwned([&sum](int value) { sum += value; });
+			}
+			signals[i](1);
+		}));
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (unsigned i = 0; i < threadCount; ++i)
+	{
+		succeed &= sums[i] == 1000;
+		succeed &= signals[i].Count() == 1000;
+	}
+
+	// The blocks of the finished threads are freed and reused from here
+	signals.clear();
+	dc::CSignal<void(int)> signal;
+	int sum = 0;
+	signal.ConnectOwned([&sum](int value) { sum += value; });
+	signal(2);
+	succeed &= sum == 2;
+
+	assert(succeed && "[Slab allocator threads tests FAILED]");
+
+	printf("- END SLAB ALLOCATOR THREADS TEST\n");
+	return succeed;
+}
+
+/*
+ Frees its block when the thread finishes, after the cache of the thread if it was created first
+ */
+struct TLateFree
+{
+	TLateFree() : mp_block(0) {}
+
+	~TLateFree()
+	{
+		dc::CSlabAllocator::Deallocate(mp_block, kSize);
+		*mp_freed = mp_block;
+	}
+
+	static const std::size_t kSize = 240;
+
+	void*	mp_block;
+	void**	mp_freed;
+};
+
+const bool SlabAllocatorTestLateFree()
+{
+	printf("+ INIT SLAB ALLOCATOR LATE FREE TEST\n");
+	bool succeed = true;
+
+	// The holder is constructed before the cache of the thread, so it's destroyed after it
+	void* freed = 0;
+	std::thread([&freed]()
+	{
+		static thread_local TLateFree lateFree;
+		lateFree.mp_freed = &freed;
+		lateFree.mp_block = dc::CSlabAllocator::Allocate(TLateFree::kSize);
+	}).join();
+	succeed &= freed != 0;
+
+	// The block went to the depot, so it's the first one a new thread takes
+	void* reused = 0;
+	std::thread([&reused]()
+	{
+		reused = dc::CSlabAllocator::Allocate(TLateFree::kSize);
+		dc::CSlabAllocator::Deallocate(reused, TLateFree::kSize);
+	}).join();
+	succeed &= reused == freed;
+
+	assert(succeed && "[Slab allocator late free tests FAILED]");
+
+	printf("- END SLAB ALLOCATOR LATE FREE TEST\n");
+	return succeed;
+}
+
+/*
+ Callable that can only be moved
+ */
+struct TMoveOnlyFunctor
+{
+	explicit TMoveOnlyFunctor(int* counter) : mp_counter(new int*(counter)) {}
+
+	void operator()(const char* message) const { ++**mp_counter; }
+
+	std::unique_ptr<int*> mp_counter;
+};
+
+const bool SlabAllocatorTestOwnedConnections()
+{
+	printf("+ INIT OWNED CONNECTIONS TEST\n");
+	bool succeed = true;
+
+	const std::size_t heapBytes = dc::CSignalMemory::HeapBytes();
+	{
+		int calls = 0;
+		dc::CSignal<void(const char*)> signal;
+
+		// The temporaries are copied into the signal
+		auto connection = signal.ConnectOwned([&calls](const char* message) { ++calls; });
+		signal.ConnectOwned(TCountingFunctor());
+		signal.ConnectOwned(TMoveOnlyFunctor(&calls));
+		succeed &= signal.Count() == 3;
+		succeed &= signal.MemoryUsage().callables > 0;
+
+		signal("Owned");
+		succeed &= calls == 2;
+
+		// Copies of the signal own copies of the callables
+		dc::CSignal<void(const char*)> copy;
+		{
+			dc::CSignal<void(const char*)> copyable;
+			copyable.ConnectOwned([&calls](const char* message) { calls += 10; });
+			copy = copyable;
+		}
+		copy("Copied");
+		succeed &= calls == 12;
+
+		// Unless one of them can only be moved, and then the copy fails leaving the target as it was
+		bool hasThrown = false;
+		try
+		{
+			copy = signal;
+		}
+		catch (const std::logic_error& error)
+		{
+			hasThrown = true;
+		}
+		succeed &= hasThrown && copy.Count() == 1;
+		copy("Not copied");
+		succeed &= calls == 22;
+
+		// Disconnecting through the returned connection releases the callable
+		const std::size_t callables = signal.MemoryUsage().callables;
+		connection.Disconnect();
+		succeed &= signal.Count() == 2;
+		succeed &= signal.MemoryUsage().callables < callables;
+
+		signal("Disconnected");
+		succeed &= calls == 23;
+
+		// The storage can grow and shrink without losing the callables
+		signal.Reserve(64);
+		signal.ShrinkToFit();
+		signal("Moved");
+		succeed &= calls == 24;
+	}
+
+	// Every owned callable was released
+	succeed &= dc::CSignalMemory::HeapBytes() == heapBytes;
+
+	assert(succeed && "[Owned connections tests FAILED]");
+
+	printf("- END OWNED CONNECTIONS TEST\n");
+	return succeed;
+}
+
+void TestDCSlabAllocator()
+{
+	printf("+++ TEST DC SLAB ALLOCATOR\n\n");
+
+	bool succeed = true;
+	succeed &= SlabAllocatorTestBlocks();
+	succeed &= SlabAllocatorTestThreads();
+	succeed &= SlabAllocatorTestLateFree();
+	succeed &= SlabAllocatorTestOwnedConnections();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC SLAB ALLOCATOR\n");
+}
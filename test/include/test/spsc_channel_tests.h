@@ -0,0 +1,208 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * spsc_channel_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+
+#include <signals/spsc_channel.h>
+#include <signals/event_loop.h>
+
+#include "allocation_tests.h"
+
+const bool SpscChannelTestOrder()
+{
+	printf("+ INIT SPSC CHANNEL ORDER TEST\n");
+	bool succeed = true;
+
+	// Move-only arguments are moved through the ring
+	dc::CSpscChannel<void(std::unique_ptr<int>, int)> channel(4);
+	succeed &= channel.Capacity() == 4;
+
+	int sum = 0;
+	channel.ConnectOwned([&sum](std::unique_ptr<int> value, int factor) { sum += *value * factor; });
+
+	for (int i = 1; i <= 4; ++i) succeed &= channel.TryPush(std::unique_ptr<int>(new int(i)), 10);
+	succeed &= !channel.TryPush(std::unique_ptr<int>(new int(5)), 10);
+
+	succeed &= channel.Drain(3) == 3;
+	succeed &= sum == 60;
+	succeed &= channel.Drain() == 1;
+	succeed &= sum == 100;
+	succeed &= channel.Drain() == 0;
+
+	// No allocation per push nor emission
+	dc::CSpscChannel<void(int)> numbers(64);
+	numbers.ConnectOwned([&sum](int value) { sum += value; });
+	CAllocationCounter counter;
+	for (int i = 0; i < 64; ++i) numbers.TryPush(i);
+	numbers.Drain();
+	succeed &= counter.Count() == 0;
+
+	// The destructor releases what wasn't drained
+	{
+		dc::CSpscChannel<void(std::unique_ptr<int>, int)> pending(8);
+		pending.Push(std::unique_ptr<int>(new int(1)), 1);
+	}
+
+	assert(succeed && "[SPSC channel order tests FAILED]");
+
+	printf("- END SPSC CHANNEL ORDER TEST\n");
+	return succeed;
+}
+
+const bool SpscChannelTestThrowingSlot()
+{
+	printf("+ INIT SPSC CHANNEL THROWING SLOT TEST\n");
+	bool succeed = true;
+
+	dc::CSpscChannel<void(std::shared_ptr<int>)> channel(8);
+
+	std::vector<int> received;
+	channel.ConnectOwned([&received](std::shared_ptr<int> value)
+	{
+		if (*value == 2) throw std::runtime_error("Slot failed");
+		received.push_back(*value);
+	});
+
+	std::shared_ptr<int> values[] = { std::make_shared<int>(1), std::make_shared<int>(2), std::make_shared<int>(3) };
+	for (const std::shared_ptr<int>& value : values) channel.TryPush(value);
+
+	bool hasThrown = false;
+	try
+	{
+		channel.Drain();
+	}
+	catch (const std::runtime_error& error)
+	{
+		hasThrown = true;
+	}
+	succeed &= hasThrown;
+
+	// The emission that threw was released, only the one after it is left
+	succeed &= values[0].use_count() == 1 && values[1].use_count() == 1 && values[2].use_count() == 2;
+	succeed &= channel.Drain() == 1;
+	succeed &= received.size() == 2 && received[0] == 1 && received[1] == 3;
+	succeed &= values[2].use_count() == 1;
+
+	assert(succeed && "[SPSC channel throwing slot tests FAILED]");
+
+	printf("- END SPSC CHANNEL THROWING SLOT TEST\n");
+	return succeed;
+}
+
+/*
+ Slot of the measures, the same for every queue: sums the values and checks they come in order
+ */
+struct TOrderedSum
+{
+	TOrderedSum() : sum(0), expected(0), isOrdered(true) {}
+
+	void operator()(int value)
+	{
+		isOrdered &= value == expected++;
+		sum += value;
+	}
+
+	long long	sum;
+	int			expected;
+	bool		isOrdered;
+};
+
+template<typename TPush, typename TDrain>
+const double SpscChannelMeasure(const TPush& push, const TDrain& drain, const int count)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::thread producer([&push, count]()
+	{
+		for (int i = 0; i < count; ++i) push(i);
+	});
+
+	int received = 0;
+	while (received < count)
+	{
+		const unsigned drained = drain();
+		if (drained == 0) std::this_thread::yield();
+		received += drained;
+	}
+	producer.join();
+
+	const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+	return count / seconds.count();
+}
+
+const bool SpscChannelTestThreads()
+{
+	printf("+ INIT SPSC CHANNEL THREADS TEST\n");
+	bool succeed = true;
+
+	const int count = 1000000;
+
+	// The ring has room for long bursts, like the unbounded queue it's compared with
+	TOrderedSum channelSum;
+	dc::CSpscChannel<void(int)> channel(64 * 1024);
+	channel.Connect(channelSum);
+	const double channelRate = SpscChannelMeasure([&channel](int value) { channel.Push(value); }, [&channel]() { return channel.Drain(); }, count);
+	succeed &= channelSum.isOrdered && channelSum.sum == (long long)count * (count - 1) / 2;
+
+#if defined(__linux__)
+	// The queued emissions of the event loop executor, a mutex protected queue, are what the channel replaces
+	TOrderedSum queueSum;
+	dc::CSignal<void(int)> signal;
+	signal.Connect(queueSum);
+	dc::CEventLoopExecutor loop;
+	const double queueRate = SpscChannelMeasure([&loop, &signal](int value) { loop.Emit(signal, value); }, [&loop]() { return loop.Drain(); }, count);
+	succeed &= queueSum.isOrdered && queueSum.sum == channelSum.sum;
+
+	printf("SPSC channel: %.1f M emissions/s, event loop queue: %.1f M emissions/s\n", channelRate / 1e6, queueRate / 1e6);
+#else
+	printf("SPSC channel: %.1f M emissions/s\n", channelRate / 1e6);
+#endif
+
+	assert(succeed && "[SPSC channel threads tests FAILED]");
+
+	printf("- END SPSC CHANNEL THREADS TEST\n");
+	return succeed;
+}
+
+void TestDCSpscChannel()
+{
+	printf("+++ TEST DC SPSC CHANNEL\n\n");
+
+	bool succeed = true;
+	succeed &= SpscChannelTestOrder();
+	succeed &= SpscChannelTestThrowingSlot();
+	succeed &= SpscChannelTestThreads();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC SPSC CHANNEL\n");
+}
@@ -0,0 +1,269 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * timed_signal_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include <signals/timed_signal.h>
+
+#include "allocation_tests.h"
+
+/*
+ Clock advanced by hand, so the tests don't depend on the time they take
+ */
+struct TManualClock
+{
+	TManualClock() : now(std::chrono::steady_clock::time_point()) {}
+
+	std::chrono::steady_clock::time_point operator()() const { return now; }
+
+	void Advance(const unsigned milliseconds) { now += std::chrono::milliseconds(milliseconds); }
+
+	std::chrono::steady_clock::time_point now;
+};
+
+/*
+ Timer recording the tick it expired in
+ */
+struct TRecordingTimer : dc::CTimer
+{
+	TRecordingTimer(std::vector<unsigned>* expirations, const unsigned* tick) :
+		dc::CTimer(&TRecordingTimer::Expire),
+		mp_expirations(expirations),
+		mp_tick(tick)
+	{}
+
+	static void Expire(dc::CTimer& timer)
+	{
+		TRecordingTimer& recording = static_cast<TRecordingTimer&>(timer);
+		recording.mp_expirations->push_back(*recording.mp_tick);
+	}
+
+	std::vector<unsigned>*	mp_expirations;
+	const unsigned*			mp_tick;
+};
+
+const bool TimedSignalTestWheel()
+{
+	printf("+ INIT TIMING WHEEL TEST\n");
+	bool succeed = true;
+
+	TManualClock clock;
+	dc::CTimingWheel wheel(std::chrono::milliseconds(1), std::ref(clock));
+
+	unsigned tick = 0;
+	std::vector<unsigned> expirations;
+	std::vector<TRecordingTimer*> timers;
+
+	// Delays in every level of the wheel, and beyond it
+	const unsigned delays[] = { 0, 1, 63, 64, 65, 4095, 4096, 5000, 262143, 262144, 300000, 16777216 + 10 };
+	for (const unsigned delay : delays)
+	{
+		TRecordingTimer* timer = new TRecordingTimer(&expirations, &tick);
+		wheel.Schedule(*timer, std::chrono::milliseconds(delay));
+		timers.push_back(timer);
+	}
+
+	// Cancelled in constant time, the destructor cancels too
+	TRecordingTimer cancelled(&expirations, &tick);
+	wheel.Schedule(cancelled, std::chrono::milliseconds(10));
+	succeed &= wheel.PendingCount() == 13;
+	cancelled.Cancel();
+	succeed &= wheel.PendingCount() == 12 && !cancelled.IsPending();
+	{
+		TRecordingTimer destroyed(&expirations, &tick);
+		wheel.Schedule(destroyed, std::chrono::milliseconds(20));
+	}
+	succeed &= wheel.PendingCount() == 12;
+
+	// Every timer expires in the first update at or after its delay, whatever the steps of the clock
+	const unsigned steps[] = { 1, 7, 64, 1000 };
+	std::vector<unsigned> updates;
+	while (wheel.PendingCount() > 0 && tick < 17000000)
+	{
+		const unsigned advance = steps[updates.size() % 4];
+		clock.Advance(advance);
+		tick += advance;
+		wheel.Update();
+		updates.push_back(tick);
+	}
+
+	succeed &= expirations.size() == 12;
+	for (unsigned i = 0; i < expirations.size() && i < 12; ++i)
+	{
+		succeed &= expirations[i] == *std::lower_bound(updates.begin(), updates.end(), delays[i]);
+	}
+
+	for (TRecordingTimer* timer : timers) delete timer;
+
+	assert(succeed && "[Timing wheel tests FAILED]");
+
+	printf("- END TIMING WHEEL TEST\n");
+	return succeed;
+}
+
+const bool TimedSignalTestDelayed()
+{
+	printf("+ INIT DELAYED SIGNAL TEST\n");
+	bool succeed = true;
+
+	TManualClock clock;
+	dc::CTimingWheel wheel(std::chrono::milliseconds(1), std::ref(clock));
+	dc::CDelayedSignal<void(const std::string&)> signal(wheel);
+
+	std::string trace;
+	signal.ConnectOwned([&trace](const std::string& text) { trace += text; });
+
+	signal.EmitAfter(std::chrono::milliseconds(30), "c");
+	signal.EmitAfter(std::chrono::milliseconds(10), "a");
+	const dc::CDelayedSignal<void(const std::string&)>::SEmissionHandle cancelled = signal.EmitAfter(std::chrono::milliseconds(20), "x");
+	signal.EmitAfter(std::chrono::milliseconds(20), "b");
+	succeed &= signal.Cancel(cancelled);
+	succeed &= signal.PendingCount() == 3;
+
+	// The handles of emissions cancelled are stale, even once their slot is reused
+	const dc::CDelayedSignal<void(const std::string&)>::SEmissionHandle reused = signal.EmitAfter(std::chrono::milliseconds(40), "d");
+	succeed &= reused.m_slot == cancelled.m_slot;
+	succeed &= !signal.IsPending(cancelled) && !signal.Cancel(cancelled);
+	succeed &= signal.IsPending(reused) && signal.PendingCount() == 4;
+
+	clock.Advance(9);
+	wheel.Update();
+	succeed &= trace.empty();
+
+	clock.Advance(1);
+	wheel.Update();
+	succeed &= trace == "a";
+
+	clock.Advance(100);
+	succeed &= wheel.Update() == 3;
+	succeed &= trace == "abcd" && signal.PendingCount() == 0;
+
+	// And so are the ones of emissions already happened
+	succeed &= !signal.Cancel(reused);
+
+	// Thousands of pending emissions, scheduled without touching the heap once the slab is warm
+	for (unsigned i = 0; i < 4096; ++i) signal.EmitAfter(std::chrono::milliseconds(i), "");
+	signal.CancelAll();
+
+	CAllocationCounter counter;
+	for (unsigned i = 0; i < 4096; ++i) signal.EmitAfter(std::chrono::milliseconds(i % 500), "");
+	succeed &= counter.Count() == 0;
+	succeed &= wheel.PendingCount() == 4096;
+
+	clock.Advance(500);
+	succeed &= wheel.Update() == 4096;
+
+	assert(succeed && "[Delayed signal tests FAILED]");
+
+	printf("- END DELAYED SIGNAL TEST\n");
+	return succeed;
+}
+
+const bool TimedSignalTestRateLimited()
+{
+	printf("+ INIT RATE LIMITED SIGNALS TEST\n");
+	bool succeed = true;
+
+	TManualClock clock;
+	dc::CTimingWheel wheel(std::chrono::milliseconds(1), std::ref(clock));
+
+	// Debounce: only the last value once the emissions stop for 50 ms
+	dc::CDebouncedSignal<void(int)> resized(wheel, std::chrono::milliseconds(50));
+	std::vector<int> sizes;
+	resized.ConnectOwned([&sizes](int size) { sizes.push_back(size); });
+
+	for (int i = 1; i <= 5; ++i)
+	{
+		resized(i * 100);
+		clock.Advance(20);
+		wheel.Update();
+	}
+	succeed &= sizes.empty() && resized.IsPending();
+
+	clock.Advance(30);
+	wheel.Update();
+	succeed &= sizes == std::vector<int>({ 500 });
+
+	resized(600);
+	resized.Cancel();
+	clock.Advance(100);
+	wheel.Update();
+	succeed &= sizes.size() == 1;
+
+	// Throttle: the first value at once, then the last one of every interval of 100 ms
+	dc::CThrottledSignal<void(int)> moved(wheel, std::chrono::milliseconds(100));
+	std::vector<int> positions;
+	moved.ConnectOwned([&positions](int position) { positions.push_back(position); });
+
+	succeed &= moved(1);
+	for (int i = 2; i <= 10; ++i)
+	{
+		succeed &= !moved(i);
+		clock.Advance(10);
+		wheel.Update();
+	}
+	succeed &= positions == std::vector<int>({ 1 });
+
+	clock.Advance(10);
+	wheel.Update();
+	succeed &= positions == std::vector<int>({ 1, 10 });
+
+	// The trailing emission opened another interval
+	succeed &= !moved(11);
+	clock.Advance(100);
+	wheel.Update();
+	succeed &= positions == std::vector<int>({ 1, 10, 11 });
+
+	clock.Advance(100);
+	wheel.Update();
+	succeed &= moved(12);
+	succeed &= positions == std::vector<int>({ 1, 10, 11, 12 });
+
+	assert(succeed && "[Rate limited signals tests FAILED]");
+
+	printf("- END RATE LIMITED SIGNALS TEST\n");
+	return succeed;
+}
+
+void TestDCTimedSignals()
+{
+	printf("+++ TEST DC TIMED SIGNALS\n\n");
+
+	bool succeed = true;
+	succeed &= TimedSignalTestWheel();
+	succeed &= TimedSignalTestDelayed();
+	succeed &= TimedSignalTestRateLimited();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC TIMED SIGNALS\n");
+}
@@ -0,0 +1,170 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * tracer_tests.h
+ *
+ *  Created on: 18 de oct. de 2026
+ *      Author: jorge
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+
+#include <signals/signal.h>
+
+const std::string ReadWholeFile(const char* path)
+{
+	std::string content;
+	FILE* file = fopen(path, "r");
+	if (!file) return content;
+
+	char buffer[4096];
+	size_t read = 0;
+	while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{
+		content.append(buffer, read);
+	}
+	fclose(file);
+	return content;
+}
+
+const bool TracerTestCascade()
+{
+	printf("+ INIT TRACER TEST\n");
+	bool succeed = true;
+
+	const char* tracePath = "dcpp_signals_trace.json";
+
+	// A slot of the first signal emits the second one
+	TCountingFunctor functor;
+	dc::CSignal<void(const char*)> cascaded;
+	cascaded.SetName("test.cascaded");
+	cascaded.Connect(functor);
+
+	dc::CSignal<void(const char*)> signal;
+	signal.SetName("test.traced");
+	auto relay = [&cascaded](const char* message) { cascaded(message); };
+	signal.Connect(relay);
+
+	dc::CTracer& tracer = dc::CTracer::Instance();
+	tracer.Clear();
+	tracer.Start();
+	signal("Traced emission");
+	tracer.Stop();
+
+	// Nothing is recorded after stopping
+	signal("Not traced emission");
+
+	succeed &= functor.calls == 2;
+	succeed &= tracer.Write(tracePath);
+
+	const std::string trace = ReadWholeFile(tracePath);
+	succeed &= trace.find("\"traceEvents\"") != std::string::npos;
+
+#if defined(DCPP_SIGNALS_TRACING)
+	// Begin and end of both emissions and both slots
+	succeed &= trace.find("test.traced") != std::string::npos;
+	succeed &= trace.find("test.cascaded") != std::string::npos;
+
+	unsigned eventCount = 0;
+	for (size_t position = trace.find("\"ph\""); position != std::string::npos; position = trace.find("\"ph\"", position + 1))
+	{
+		++eventCount;
+	}
+	succeed &= eventCount == 8;
+#else
+	succeed &= trace.find("test.traced") == std::string::npos;
+#endif
+
+	remove(tracePath);
+
+	assert(succeed && "[Tracer tests FAILED]");
+
+	printf("- END TRACER TEST\n");
+	return succeed;
+}
+
+const bool TracerTestWrappedRing()
+{
+	printf("+ INIT TRACER WRAPPED RING TEST\n");
+	bool succeed = true;
+
+	const char* tracePath = "dcpp_signals_wrapped_trace.json";
+
+	// Names that have to be escaped in the JSON strings
+	TCountingFunctor functor;
+	dc::CSignal<void(const char*)> inner;
+	inner.SetName("test.\"quoted\"\\path\n");
+	inner.Connect(functor);
+
+	// The slot of the outer signal records more events than fit in the ring, so its begins are overwritten
+	const unsigned emissionCount = dc::CTraceBuffer::kCapacity / 4 + 100;
+	dc::CSignal<void(const char*)> outer;
+	outer.SetName("test.outer");
+	auto flood = [&](const char* message) { for (unsigned i = 0; i < emissionCount; ++i) inner(message); };
+	outer.Connect(flood);
+
+	dc::CTracer& tracer = dc::CTracer::Instance();
+	tracer.Clear();
+	tracer.Start();
+	outer("Flooding emission");
+	tracer.Stop();
+
+	succeed &= functor.calls == emissionCount;
+	succeed &= tracer.Write(tracePath);
+
+	const std::string trace = ReadWholeFile(tracePath);
+
+#if defined(DCPP_SIGNALS_TRACING)
+	succeed &= trace.find("\"name\":\"test.\\\"quoted\\\"\\\\path\\u000a\"") != std::string::npos;
+	succeed &= trace.find("test.outer") == std::string::npos;
+
+	// The ends of the outer emission and its slot are dropped with their begins
+	unsigned beginCount = 0;
+	unsigned endCount = 0;
+	for (size_t position = trace.find("\"ph\":\"B\""); position != std::string::npos; position = trace.find("\"ph\":\"B\"", position + 1)) ++beginCount;
+	for (size_t position = trace.find("\"ph\":\"E\""); position != std::string::npos; position = trace.find("\"ph\":\"E\"", position + 1)) ++endCount;
+	succeed &= beginCount > 0 && beginCount == endCount;
+#else
+	succeed &= trace.find("quoted") == std::string::npos;
+#endif
+
+	tracer.Clear();
+	remove(tracePath);
+
+	assert(succeed && "[Tracer wrapped ring tests FAILED]");
+
+	printf("- END TRACER WRAPPED RING TEST\n");
+	return succeed;
+}
+
+void TestDCTracer()
+{
+	printf("+++ TEST DC TRACER\n\n");
+
+	bool succeed = TracerTestCascade();
+	succeed &= TracerTestWrappedRing();
+
+	if(succeed)
+	{
+		printf("\n+ ALL TESTS WERE SUCCESSFUL\n\n");
+	}
+	else
+	{
+		printf("\n- TESTS FAILED\n\n");
+	}
+	printf("---END TEST DC TRACER\n");
+}
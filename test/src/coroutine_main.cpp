@@ -0,0 +1,34 @@
+/*
+ The MIT License (MIT)
+
+ Copyright (c) 2016 Jorge López González
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+//
+//  coroutine_main.cpp
+//  SignalsTest
+//
+//  Created by Jorge López on 18/10/26.
+//  Copyright © 2026 Jorge López. All rights reserved.
+//
+
+// The coroutine tests use the helpers of the signal tests
+#include "signal_tests.h"
+#include "coroutine_tests.h"
+
+// Built as C++20, so the awaiter of the signals is always tested here
+#if !defined(__cpp_impl_coroutine)
+#error "The coroutines test must be compiled with coroutines support"
+#endif
+
+int main()
+{
+	TestDCCoroutines();
+	return 0;
+}
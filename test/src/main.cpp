@@ -22,10 +22,56 @@
 #include "signal_tests.h"
 #include "silly_tests.h"
 #include "perfect_forwarding_tests.h"
+#include "signal_table_tests.h"
+#include "event_bus_tests.h"
+#include "event_hub_tests.h"
+#include "instrumentation_tests.h"
+#include "profiler_tests.h"
+#include "tracer_tests.h"
+#include "allocation_tests.h"
+#include "slab_allocator_tests.h"
+#include "async_emission_tests.h"
+#include "coroutine_tests.h"
+#include "result_range_tests.h"
+#include "lazy_emission_tests.h"
+#include "move_only_tests.h"
+#include "relay_tests.h"
+#include "pipeline_tests.h"
+#include "replay_tests.h"
+#include "timed_signal_tests.h"
+#include "bubbling_tests.h"
+#include "emission_log_tests.h"
+#include "shared_signal_tests.h"
+#include "spsc_channel_tests.h"
+#include "event_loop_tests.h"
 
 int main()
 {
+	// Forks, so it goes before the tests that leave threads running
+	TestDCSharedSignals();
+
 	TestDCSignal();
+	TestDCSignalTable();
+	TestDCEventBus();
+	TestDCEventHub();
+	TestDCInstrumentation();
+	TestDCProfiler();
+	TestDCTracer();
+	TestDCAllocations();
+	TestDCSlabAllocator();
+	TestDCAsyncEmission();
+	TestDCCoroutines();
+	TestDCResultRange();
+	TestDCLazyEmission();
+	TestDCMoveOnly();
+	TestDCRelays();
+	TestDCPipelines();
+	TestDCReplay();
+	TestDCTimedSignals();
+	TestDCBubbling();
+	TestDCEmissionLog();
+	TestDCSpscChannel();
+	TestDCEventLoop();
 	
 	std::cout << "Enter to exit the program: ";
 	std::cin.ignore().get();